@@ -0,0 +1,62 @@
+# Compares the math builtin with the bc pipeline that the math function used to run, by counting
+# to ITERATIONS with each. Run it with the fish under test:
+#
+#     ./fish benchmarks/math.fish [ITERATIONS]
+#
+# The bc version is skipped if bc is not installed.
+
+set -l iterations 1000
+set -q argv[1]
+and set iterations $argv[1]
+
+# The body of the old math function, minus option handling.
+function __bench_math_bc
+    echo "scale=0; $argv" | bc | string replace -r '\\\\$' '' | string join ''
+end
+
+# Milliseconds since the epoch. BSD date doesn't support %N, so fall back to whole seconds there.
+function __bench_now_ms
+    set -l now (date +%s%N)
+    if string match -q '*N' -- $now
+        math (date +%s) \* 1000
+    else
+        math $now / 1000000
+    end
+end
+
+# Count to the given number, once with the builtin and once with bc.
+function __bench_count_math
+    set -l count 0
+    while test $count -lt $argv[1]
+        set count (math $count + 1)
+    end
+end
+
+function __bench_count_bc
+    set -l count 0
+    while test $count -lt $argv[1]
+        set count (__bench_math_bc $count + 1)
+    end
+end
+
+set -l implementations math
+if type -q bc
+    set implementations $implementations bc
+else
+    echo "bc not found, only timing the builtin"
+end
+
+set -l elapsed
+for impl in $implementations
+    set -l start (__bench_now_ms)
+    eval __bench_count_$impl $iterations
+    set -l ms (math (__bench_now_ms) - $start)
+    set elapsed $elapsed $ms
+    printf '%-4s %6d iterations in %6d ms\n' $impl $iterations $ms
+end
+
+if set -q elapsed[2]; and test $elapsed[1] -gt 0
+    echo "builtin speedup: "(math -s1 $elapsed[2] / $elapsed[1])"x"
+end
+
+functions -e __bench_math_bc __bench_now_ms __bench_count_math __bench_count_bc
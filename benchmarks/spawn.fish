@@ -0,0 +1,59 @@
+# Compares starting external commands with fork and with posix_spawn, by running `command true`
+# ITERATIONS times in a fish with fish_use_posix_spawn set each way. Each is timed in a small shell
+# and in one that has grown by holding a list of BALLAST elements, since fork gets slower as the
+# shell gets bigger, and both with and without its output redirected to a file. Run it with the fish
+# under test:
+#
+#     ./fish benchmarks/spawn.fish [ITERATIONS] [BALLAST]
+
+set -l iterations 2000
+set -q argv[1]
+and set iterations $argv[1]
+set -l ballast 500000
+set -q argv[2]
+and set ballast $argv[2]
+
+set -l fish $__fish_bin_dir/fish
+set -l redirect_file (mktemp)
+
+# The loop each child fish runs, given the iterations, ballast and the file to redirect to, if any,
+# in the environment. It prints the milliseconds taken, using date +%s%N, which BSD date doesn't
+# support; fall back to whole seconds there.
+set -l script '
+    function __bench_now_ms
+        set -l now (date +%s%N)
+        if string match -q "*N" -- $now
+            math (date +%s) \* 1000
+        else
+            math $now / 1000000
+        end
+    end
+    set -l ballast (seq $__bench_ballast)
+    set -l start (__bench_now_ms)
+    if test -n "$__bench_redirect"
+        for i in (seq $__bench_iterations)
+            command true >$__bench_redirect
+        end
+    else
+        for i in (seq $__bench_iterations)
+            command true
+        end
+    end
+    math (__bench_now_ms) - $start
+'
+
+for size in 0 $ballast
+    for redirect in '' $redirect_file
+        set -l elapsed
+        for spawn in 0 1
+            set elapsed $elapsed (env fish_use_posix_spawn=$spawn __bench_iterations=$iterations \
+                __bench_ballast=$size __bench_redirect=$redirect $fish -c $script)
+        end
+        set -l kind commands
+        test -n "$redirect"
+        and set kind 'redirected commands'
+        printf '%7d element ballast: fork %6d ms, spawn %6d ms for %d %s\n' $size $elapsed \
+            $iterations $kind
+    end
+end
+rm -f $redirect_file
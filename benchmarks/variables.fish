@@ -0,0 +1,55 @@
+# Times list variable operations: appending to a list in a loop, with `set -a` and by
+# re-expanding the list, and reading single elements and slices of a long list. Run it with the
+# fish under test:
+#
+#     ./fish benchmarks/variables.fish [ELEMENTS]
+
+set -l elements 10000
+set -q argv[1]
+and set elements $argv[1]
+
+# Milliseconds since the epoch. BSD date doesn't support %N, so fall back to whole seconds there.
+function __bench_now_ms
+    set -l now (date +%s%N)
+    if string match -q '*N' -- $now
+        math (date +%s) \* 1000
+    else
+        math $now / 1000000
+    end
+end
+
+function __bench_append
+    set -l list
+    for i in (seq $argv[1])
+        set -a list $i
+    end
+end
+
+function __bench_reexpand
+    set -l list
+    for i in (seq $argv[1])
+        set list $list $i
+    end
+end
+
+function __bench_index
+    set -l list (seq $argv[1])
+    for i in (seq $argv[1])
+        set -l element $list[$i]
+    end
+end
+
+function __bench_slice
+    set -l list (seq $argv[1])
+    for i in (seq 100)
+        set -l slice $list[2..-2]
+    end
+end
+
+for bench in append reexpand index slice
+    set -l start (__bench_now_ms)
+    eval __bench_$bench $elements
+    printf '%-8s %6d elements in %6d ms\n' $bench $elements (math (__bench_now_ms) - $start)
+end
+
+functions -e __bench_now_ms __bench_append __bench_reexpand __bench_index __bench_slice
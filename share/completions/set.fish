@@ -62,6 +62,8 @@ complete -c set -n '__fish_is_first_token' -s g -l global --description "Make va
 complete -c set -n '__fish_is_first_token' -s l -l local --description "Make variable scope local"
 complete -c set -n '__fish_is_first_token' -s U -l universal --description "Share variable persistently across sessions"
 complete -c set -n '__fish_is_first_token' -s q -l query --description "Test if variable is defined"
+complete -c set -n '__fish_is_first_token' -s a -l append --description "Add values to the end of the variable"
+complete -c set -n '__fish_is_first_token' -s p -l prepend --description "Add values to the start of the variable"
 complete -c set -n '__fish_is_first_token' -s h -l help --description "Display help and exit"
 complete -c set -n '__fish_is_first_token' -s n -l names --description "List the names of the variables, but not their value"
 
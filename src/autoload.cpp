@@ -117,9 +117,7 @@ bool autoload_t::can_load(const wcstring &cmd, const env_vars_snapshot_t &vars)
     const env_var_t path_var = vars.get(env_var_name);
     if (path_var.missing_or_empty()) return false;
 
-    std::vector<wcstring> path_list;
-    tokenize_variable_array(path_var, path_list);
-    return this->locate_file_and_maybe_load_it(cmd, false, false, path_list);
+    return this->locate_file_and_maybe_load_it(cmd, false, false, path_var.as_list());
 }
 
 static bool script_name_precedes_script_name(const builtin_script_t &script1,
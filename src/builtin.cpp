@@ -39,6 +39,7 @@
 #include "builtin_commandline.h"
 #include "builtin_complete.h"
 #include "builtin_jobs.h"
+#include "builtin_math.h"
 #include "builtin_printf.h"
 #include "builtin_set.h"
 #include "builtin_set_color.h"
@@ -880,6 +881,73 @@ static int builtin_command(parser_t &parser, io_streams_t &streams, wchar_t **ar
     return found ? STATUS_BUILTIN_OK : STATUS_BUILTIN_ERROR;
 }
 
+/// Implementation of the builtin hash command. This lists or clears the cache of command locations,
+/// and can add commands to it.
+static int builtin_hash(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
+    wgetopter_t w;
+    int argc = builtin_count_args(argv);
+    bool reset = false;
+
+    w.woptind = 0;
+
+    static const struct woption long_options[] = {
+        {L"reset", no_argument, 0, 'r'}, {L"help", no_argument, 0, 'h'}, {0, 0, 0, 0}};
+
+    while (1) {
+        int opt_index = 0;
+
+        int opt = w.wgetopt_long(argc, argv, L"rh", long_options, &opt_index);
+        if (opt == -1) break;
+
+        switch (opt) {
+            case 0: {
+                if (long_options[opt_index].flag != 0) break;
+                streams.err.append_format(BUILTIN_ERR_UNKNOWN, argv[0],
+                                          long_options[opt_index].name);
+                builtin_print_help(parser, streams, argv[0], streams.err);
+                return STATUS_BUILTIN_ERROR;
+            }
+            case 'h': {
+                builtin_print_help(parser, streams, argv[0], streams.out);
+                return STATUS_BUILTIN_OK;
+            }
+            case 'r': {
+                reset = true;
+                break;
+            }
+            case '?': {
+                builtin_unknown_option(parser, streams, argv[0], argv[w.woptind - 1]);
+                return STATUS_BUILTIN_ERROR;
+            }
+            default: {
+                DIE("unexpected opt");
+                break;
+            }
+        }
+    }
+
+    if (reset) path_cache_clear();
+
+    // Look up the given commands, which adds them to the cache.
+    int status = STATUS_BUILTIN_OK;
+    for (int idx = w.woptind; argv[idx]; ++idx) {
+        if (!path_get_path(argv[idx], NULL)) {
+            streams.err.append_format(_(L"%ls: %ls: not found\n"), argv[0], argv[idx]);
+            status = STATUS_BUILTIN_ERROR;
+        }
+    }
+
+    if (!reset && w.woptind == argc) {
+        std::vector<unsigned long> hits;
+        const wcstring_list_t paths = path_cache_list(&hits);
+        if (!paths.empty()) streams.out.append(_(L"hits\tcommand\n"));
+        for (size_t i = 0; i < paths.size(); i++) {
+            streams.out.append_format(L"%4lu\t%ls\n", hits.at(i), paths.at(i).c_str());
+        }
+    }
+    return status;
+}
+
 /// A generic bultin that only supports showing a help message. This is only a placeholder that
 /// prints the help message. Useful for commands that live in the parser.
 static int builtin_generic(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
@@ -1012,9 +1080,7 @@ static wcstring functions_def(const wcstring &name) {
                                                        end = inherit_vars.end();
          it != end; ++it) {
         wcstring_list_t lst;
-        if (!it->second.missing()) {
-            tokenize_variable_array(it->second, lst);
-        }
+        if (!it->second.missing()) lst = it->second.as_list();
 
         // This forced tab is crummy, but we don't know what indentation style the function uses.
         append_format(out, L"\n\tset -l %ls", it->first.c_str());
@@ -1807,6 +1873,71 @@ static int builtin_random(parser_t &parser, io_streams_t &streams, wchar_t **arg
     return STATUS_BUILTIN_OK;
 }
 
+/// The number of bytes to read at once from a seekable file. Whatever follows the line is handed
+/// back with lseek, so this is kept small to avoid rereading the same bytes for every line.
+#define READ_CHUNK_SIZE_SEEKABLE 128
+
+/// Reads a line from \c fd into \c buff, stopping after a newline (or NUL with \c split_null), or
+/// after \c nchars characters if that is positive. Returns true if end of file was reached.
+///
+/// Seekable files are read in blocks, and whatever was read past the end of the line is handed back
+/// with lseek. Other input, such as a pipe or a terminal, is read a byte at a time, since anything
+/// consumed beyond the line would be lost to the next command reading the same input.
+static bool read_line_buffered(int fd, wcstring &buff, int nchars, bool split_null) {
+    size_t chunk_size = 1;
+    struct stat buf;
+    if (fstat(fd, &buf) == 0 && S_ISREG(buf.st_mode) && lseek(fd, 0, SEEK_CUR) != -1) {
+        chunk_size = READ_CHUNK_SIZE_SEEKABLE;
+    }
+
+    std::string chunk;
+    size_t pos = 0;
+    mbstate_t state = {};
+    bool eof = false;
+
+    for (;;) {
+        if (pos == chunk.size()) {
+            chunk.resize(chunk_size);
+            long amt = read_blocked(fd, &chunk.at(0), chunk_size);
+            if (amt <= 0) {
+                chunk.clear();
+                pos = 0;
+                eof = true;
+                break;
+            }
+            chunk.resize(amt);
+            pos = 0;
+        }
+
+        char b = chunk.at(pos++);
+        wchar_t res = 0;
+        if (MB_CUR_MAX == 1) {  // single-byte locale
+            res = (unsigned char)b;
+        } else {
+            size_t sz = mbrtowc(&res, &b, 1, &state);
+            if (sz == (size_t)-1) {
+                memset(&state, 0, sizeof(state));
+                continue;
+            } else if (sz == (size_t)-2) {
+                continue;
+            }
+        }
+
+        if (!split_null && res == L'\n') break;
+        if (split_null && res == L'\0') break;
+
+        buff.push_back(res);
+        if (0 < nchars && (size_t)nchars <= buff.size()) break;
+    }
+
+    // Hand back whatever we read past the end of the line.
+    size_t unconsumed = chunk.size() - pos;
+    if (unconsumed > 0) {
+        lseek(fd, -(off_t)unconsumed, SEEK_CUR);
+    }
+    return eof;
+}
+
 /// The read builtin. Reads from stdin and stores the values in environment variables.
 static int builtin_read(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
     wgetopter_t w;
@@ -2010,49 +2141,8 @@ static int builtin_read(parser_t &parser, io_streams_t &streams, wchar_t **argv)
         }
         reader_pop();
     } else {
-        int eof = 0;
-
         buff.clear();
-
-        while (1) {
-            int finished = 0;
-            wchar_t res = 0;
-            mbstate_t state = {};
-
-            while (!finished) {
-                char b;
-                if (read_blocked(streams.stdin_fd, &b, 1) <= 0) {
-                    eof = 1;
-                    break;
-                }
-
-                if (MB_CUR_MAX == 1)  // single-byte locale
-                {
-                    res = (unsigned char)b;
-                    finished = 1;
-                } else {
-                    size_t sz = mbrtowc(&res, &b, 1, &state);
-                    if (sz == (size_t)-1) {
-                        memset(&state, 0, sizeof(state));
-                    } else if (sz != (size_t)-2) {
-                        finished = 1;
-                    }
-                }
-            }
-
-            if (eof) break;
-
-            if (!split_null && res == L'\n') break;
-
-            if (split_null && res == L'\0') break;
-
-            buff.push_back(res);
-
-            if (0 < nchars && (size_t)nchars <= buff.size()) {
-                break;
-            }
-        }
-
+        bool eof = read_line_buffered(streams.stdin_fd, buff, nchars, split_null);
         if (buff.empty() && eof) {
             exit_res = STATUS_BUILTIN_ERROR;
         }
@@ -2067,18 +2157,12 @@ static int builtin_read(parser_t &parser, io_streams_t &streams, wchar_t **argv)
         // Every character is a separate token.
         size_t bufflen = buff.size();
         if (array) {
-            if (bufflen > 0) {
-                wcstring chars(bufflen + (bufflen - 1), ARRAY_SEP);
-                wcstring::iterator out = chars.begin();
-                for (wcstring::const_iterator it = buff.begin(), end = buff.end(); it != end;
-                     ++it) {
-                    *out = *it;
-                    out += 2;
-                }
-                env_set(argv[i], chars.c_str(), place);
-            } else {
-                env_set(argv[i], NULL, place);
+            wcstring_list_t chars;
+            chars.reserve(bufflen);
+            for (wcstring::const_iterator it = buff.begin(), end = buff.end(); it != end; ++it) {
+                chars.push_back(wcstring(1, *it));
             }
+            env_set(argv[i], chars, place);
         } else {  // not array
             size_t j = 0;
             for (; i + 1 < argc; ++i) {
@@ -2092,22 +2176,17 @@ static int builtin_read(parser_t &parser, io_streams_t &streams, wchar_t **argv)
             if (i < argc) env_set(argv[i], &buff[j], place);
         }
     } else if (array) {
-        wcstring tokens;
-        tokens.reserve(buff.size());
-        bool empty = true;
-
+        wcstring_list_t tokens;
         for (wcstring_range loc = wcstring_tok(buff, ifs); loc.first != wcstring::npos;
              loc = wcstring_tok(buff, ifs, loc)) {
-            if (!empty) tokens.push_back(ARRAY_SEP);
-            tokens.append(buff, loc.first, loc.second);
-            empty = false;
+            tokens.push_back(wcstring(buff, loc.first, loc.second));
         }
-        env_set(argv[i], empty ? NULL : tokens.c_str(), place);
+        env_set(argv[i], tokens, place);
     } else {  // not array
         wcstring_range loc = wcstring_range(0, 0);
 
         while (i < argc) {
-            loc = wcstring_tok(buff, (i + 1 < argc) ? ifs : wcstring(), loc);
+            loc = wcstring_tok(buff, (i + 1 < argc) ? ifs.as_string() : wcstring(), loc);
             env_set(argv[i], loc.first == wcstring::npos ? L"" : &buff.c_str()[loc.first], place);
             ++i;
         }
@@ -3304,9 +3383,11 @@ static const builtin_data_t builtin_datas[] = {
     {L"for", &builtin_generic, N_(L"Perform a set of commands multiple times")},
     {L"function", &builtin_generic, N_(L"Define a new function")},
     {L"functions", &builtin_functions, N_(L"List or remove functions")},
+    {L"hash", &builtin_hash, N_(L"List or clear remembered command locations")},
     {L"history", &builtin_history, N_(L"History of commands executed by user")},
     {L"if", &builtin_generic, N_(L"Evaluate block if condition is true")},
     {L"jobs", &builtin_jobs, N_(L"Print currently running jobs")},
+    {L"math", &builtin_math, N_(L"Perform mathematics calculations")},
     {L"not", &builtin_generic, N_(L"Negate exit status of job")},
     {L"or", &builtin_generic, N_(L"Execute command if previous command failed")},
     {L"printf", &builtin_printf, N_(L"Prints formatted text")},
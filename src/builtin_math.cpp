@@ -0,0 +1,539 @@
+// Functions used for implementing the math builtin.
+//
+// This replaces the old math function, which piped every expression through bc(1). Arithmetic is
+// evaluated with arbitrary precision decimal arithmetic using bc's rules, so results are unchanged:
+// with the default scale of zero all arithmetic is on integers, and with a scale of N results carry
+// up to N digits after the decimal point, truncated rather than rounded. Expressions using the rest
+// of bc's language (functions, variables, comparisons, ibase and obase etc.) are passed to bc.
+#include "config.h"  // IWYU pragma: keep
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <wchar.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "builtin.h"
+#include "builtin_math.h"
+#include "common.h"
+#include "exec.h"
+#include "io.h"
+#include "path.h"
+#include "proc.h"
+#include "wutil.h"  // IWYU pragma: keep
+
+/// Return status for invalid options or a missing expression.
+#define MATH_STATUS_USAGE 2
+/// Return status for an expression that cannot be evaluated.
+#define MATH_STATUS_INVALID 3
+
+/// The largest number of digits we are willing to produce. This keeps an accidental `10^10^10`
+/// from consuming all available memory.
+#define MATH_MAX_DIGITS 100000
+
+namespace {
+/// A decimal number: the value is (negative ? -1 : 1) * digits * 10^-scale. The digits are ASCII,
+/// most significant first, with no leading zeros; zero is represented by the empty string.
+struct math_number_t {
+    std::string digits;
+    size_t scale;
+    bool negative;
+
+    math_number_t() : scale(0), negative(false) {}
+
+    bool is_zero() const { return digits.empty(); }
+};
+}  // namespace
+
+static void strip_leading_zeros(std::string *digits) {
+    size_t first = digits->find_first_not_of('0');
+    digits->erase(0, first == std::string::npos ? digits->size() : first);
+}
+
+/// Multiplies a magnitude by 10^count.
+static std::string shift_magnitude(const std::string &digits, size_t count) {
+    if (digits.empty()) return digits;
+    return digits + std::string(count, '0');
+}
+
+static int compare_magnitudes(const std::string &a, const std::string &b) {
+    if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+    return a.compare(b);
+}
+
+static std::string add_magnitudes(const std::string &a, const std::string &b) {
+    std::string result;
+    int carry = 0;
+    size_t ai = a.size(), bi = b.size();
+    while (ai > 0 || bi > 0 || carry) {
+        int sum = carry;
+        if (ai > 0) sum += a.at(--ai) - '0';
+        if (bi > 0) sum += b.at(--bi) - '0';
+        result.push_back('0' + sum % 10);
+        carry = sum / 10;
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+/// Returns a - b. The caller must ensure a >= b.
+static std::string subtract_magnitudes(const std::string &a, const std::string &b) {
+    std::string result;
+    int borrow = 0;
+    size_t ai = a.size(), bi = b.size();
+    while (ai > 0) {
+        int diff = a.at(--ai) - '0' - borrow;
+        if (bi > 0) diff -= b.at(--bi) - '0';
+        borrow = diff < 0;
+        result.push_back('0' + (diff + 10) % 10);
+    }
+    std::reverse(result.begin(), result.end());
+    strip_leading_zeros(&result);
+    return result;
+}
+
+static std::string multiply_magnitudes(const std::string &a, const std::string &b) {
+    if (a.empty() || b.empty()) return std::string();
+    std::vector<unsigned long> columns(a.size() + b.size(), 0);
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) {
+            columns.at(i + j + 1) += (a.at(i) - '0') * (b.at(j) - '0');
+        }
+        // Propagate carries every so often so the columns cannot overflow.
+        if (i % 1000 == 999) {
+            for (size_t k = columns.size() - 1; k > 0; k--) {
+                columns.at(k - 1) += columns.at(k) / 10;
+                columns.at(k) %= 10;
+            }
+        }
+    }
+    std::string result(columns.size(), '0');
+    unsigned long carry = 0;
+    for (size_t k = columns.size(); k > 0; k--) {
+        unsigned long val = columns.at(k - 1) + carry;
+        result.at(k - 1) = '0' + val % 10;
+        carry = val / 10;
+    }
+    strip_leading_zeros(&result);
+    return result;
+}
+
+/// Returns a / b, truncated. The caller must ensure b is not zero.
+static std::string divide_magnitudes(const std::string &a, const std::string &b) {
+    std::string quotient, remainder;
+    for (size_t i = 0; i < a.size(); i++) {
+        remainder.push_back(a.at(i));
+        strip_leading_zeros(&remainder);
+        char digit = '0';
+        while (compare_magnitudes(remainder, b) >= 0) {
+            remainder = subtract_magnitudes(remainder, b);
+            digit++;
+        }
+        quotient.push_back(digit);
+    }
+    strip_leading_zeros(&quotient);
+    return quotient;
+}
+
+/// Returns the number with the given scale, truncating or padding digits after the decimal point.
+static math_number_t with_scale(const math_number_t &num, size_t scale) {
+    math_number_t result = num;
+    if (scale > num.scale) {
+        result.digits = shift_magnitude(num.digits, scale - num.scale);
+    } else if (scale < num.scale) {
+        size_t drop = std::min(num.scale - scale, num.digits.size());
+        result.digits.erase(result.digits.size() - drop);
+    }
+    result.scale = scale;
+    if (result.is_zero()) result.negative = false;
+    return result;
+}
+
+static math_number_t math_negate(const math_number_t &num) {
+    math_number_t result = num;
+    result.negative = !num.negative && !num.is_zero();
+    return result;
+}
+
+static math_number_t math_add(const math_number_t &a, const math_number_t &b) {
+    size_t scale = std::max(a.scale, b.scale);
+    math_number_t x = with_scale(a, scale), y = with_scale(b, scale);
+    math_number_t result;
+    result.scale = scale;
+    if (x.negative == y.negative) {
+        result.digits = add_magnitudes(x.digits, y.digits);
+        result.negative = x.negative;
+    } else if (compare_magnitudes(x.digits, y.digits) >= 0) {
+        result.digits = subtract_magnitudes(x.digits, y.digits);
+        result.negative = x.negative;
+    } else {
+        result.digits = subtract_magnitudes(y.digits, x.digits);
+        result.negative = y.negative;
+    }
+    if (result.is_zero()) result.negative = false;
+    return result;
+}
+
+/// Multiplies two numbers without losing any digits.
+static math_number_t math_multiply(const math_number_t &a, const math_number_t &b) {
+    math_number_t result;
+    result.digits = multiply_magnitudes(a.digits, b.digits);
+    result.scale = a.scale + b.scale;
+    result.negative = !result.is_zero() && a.negative != b.negative;
+    return result;
+}
+
+/// The expression evaluator. This is a recursive descent parser which computes values as it goes,
+/// using bc's precedence: unary minus binds tightest, then a right-associative `^`, then `*`, `/`
+/// and `%`, then `+` and `-`.
+class math_evaluator_t {
+    const wcstring &expression;
+    size_t pos;
+    const size_t scale;
+    wcstring error;
+    bool unsupported;
+
+    bool fail(const wcstring &message) {
+        if (error.empty()) error = message;
+        return false;
+    }
+
+    bool fail_syntax() {
+        // Letters start bc's functions, variables and keywords, and the other characters its
+        // assignments, comparisons, statements and strings. Anything else is a plain syntax error.
+        if (pos < expression.size() &&
+            (iswalpha(expression.at(pos)) || wcschr(L"=<>!&|;,[]{}\"", expression.at(pos)))) {
+            unsupported = true;
+        }
+        if (pos < expression.size()) {
+            return fail(format_string(_(L"Unexpected '%lc' in expression '%ls'"),
+                                      expression.at(pos), expression.c_str()));
+        }
+        return fail(format_string(_(L"Unexpected end of expression '%ls'"), expression.c_str()));
+    }
+
+    void skip_spaces() {
+        while (pos < expression.size() && iswspace(expression.at(pos))) pos++;
+    }
+
+    bool divide(const math_number_t &a, const math_number_t &b, math_number_t *out) {
+        if (b.is_zero()) return fail(_(L"Division by zero"));
+        math_number_t result;
+        result.digits = divide_magnitudes(shift_magnitude(a.digits, scale + b.scale),
+                                          shift_magnitude(b.digits, a.scale));
+        result.scale = scale;
+        result.negative = !result.is_zero() && a.negative != b.negative;
+        *out = result;
+        return true;
+    }
+
+    bool remainder(const math_number_t &a, const math_number_t &b, math_number_t *out) {
+        math_number_t quotient;
+        if (!divide(a, b, &quotient)) return false;
+        math_number_t difference = math_add(a, math_negate(math_multiply(quotient, b)));
+        *out = with_scale(difference, std::max(scale + b.scale, a.scale));
+        return true;
+    }
+
+    bool power(const math_number_t &base, const math_number_t &exponent, math_number_t *out) {
+        math_number_t integral = with_scale(exponent, 0);
+        if (compare_magnitudes(with_scale(integral, exponent.scale).digits, exponent.digits) != 0) {
+            // bc truncates the exponent with a warning.
+            unsupported = true;
+            return fail(_(L"Exponent must be an integer"));
+        }
+
+        // Some results are known however large the exponent is.
+        math_number_t result;
+        result.digits = "1";
+        if (integral.is_zero()) {
+            *out = result;
+            return true;
+        }
+        if (base.is_zero()) {
+            if (integral.negative) return divide(result, base, out);
+            *out = base;
+            return true;
+        }
+        size_t max_scale = std::max(scale, base.scale);
+        int magnitude = compare_magnitudes(base.digits, shift_magnitude("1", base.scale));
+        if (magnitude == 0) {
+            // A base of 1 or -1 gives 1 or -1, with the scale a multiplication would give.
+            result.negative = base.negative && (integral.digits.at(integral.digits.size() - 1) & 1);
+            if (integral.negative) {
+                math_number_t one;
+                one.digits = "1";
+                return divide(one, result, out);
+            }
+            size_t result_scale = max_scale;
+            if (integral.digits.size() <= 9) {
+                unsigned long count = strtoul(integral.digits.c_str(), NULL, 10);
+                if (count < max_scale) result_scale = std::min(max_scale, base.scale * count);
+            }
+            *out = with_scale(result, base.scale == 0 ? 0 : result_scale);
+            return true;
+        }
+        if (magnitude < 0 && !integral.negative) {
+            // A base between -1 and 1 has |base| <= 1 - 10^-base.scale, so |base|^n < e^(-n *
+            // 10^-base.scale). That truncates to zero once n > 3 * max_scale * 10^base.scale,
+            // which holds for any n with more digits than that bound.
+            size_t bound_digits = base.scale + format_string(L"%lu", 3UL * max_scale).size();
+            if (integral.digits.size() > bound_digits) {
+                *out = math_number_t();
+                return true;
+            }
+        }
+
+        if (integral.digits.size() > 9) return fail(_(L"Result is too large"));
+        unsigned long count = strtoul(integral.digits.c_str(), NULL, 10);
+        if (base.digits.size() * count > MATH_MAX_DIGITS) return fail(_(L"Result is too large"));
+
+        math_number_t square = base;
+        for (unsigned long remaining = count; remaining > 0; remaining >>= 1) {
+            if (remaining & 1) result = math_multiply(result, square);
+            if (remaining > 1) square = math_multiply(square, square);
+        }
+        if (integral.negative) {
+            math_number_t one;
+            one.digits = "1";
+            return divide(one, result, out);
+        }
+        *out = with_scale(result, std::min(result.scale, std::max(scale, base.scale)));
+        return true;
+    }
+
+    bool parse_number(math_number_t *out) {
+        std::string digits;
+        size_t fraction_digits = 0;
+        bool seen_point = false;
+        for (; pos < expression.size(); pos++) {
+            wchar_t c = expression.at(pos);
+            if (c == L'.' && !seen_point) {
+                seen_point = true;
+            } else if (c >= L'0' && c <= L'9') {
+                digits.push_back(static_cast<char>(c));
+                if (seen_point) fraction_digits++;
+            } else {
+                break;
+            }
+        }
+        if (digits.empty()) return fail_syntax();
+        strip_leading_zeros(&digits);
+        out->digits = digits;
+        out->scale = fraction_digits;
+        out->negative = false;
+        return true;
+    }
+
+    bool parse_primary(math_number_t *out) {
+        skip_spaces();
+        if (pos < expression.size() && expression.at(pos) == L'(') {
+            pos++;
+            if (!parse_sum(out)) return false;
+            skip_spaces();
+            if (pos >= expression.size() || expression.at(pos) != L')') return fail_syntax();
+            pos++;
+            return true;
+        }
+        return parse_number(out);
+    }
+
+    bool parse_unary(math_number_t *out) {
+        skip_spaces();
+        if (pos < expression.size() && expression.at(pos) == L'-') {
+            pos++;
+            if (!parse_unary(out)) return false;
+            *out = math_negate(*out);
+            return true;
+        }
+        return parse_primary(out);
+    }
+
+    bool parse_power(math_number_t *out) {
+        if (!parse_unary(out)) return false;
+        skip_spaces();
+        if (pos < expression.size() && expression.at(pos) == L'^') {
+            pos++;
+            math_number_t exponent;
+            if (!parse_power(&exponent)) return false;
+            return power(*out, exponent, out);
+        }
+        return true;
+    }
+
+    bool parse_product(math_number_t *out) {
+        if (!parse_power(out)) return false;
+        for (;;) {
+            skip_spaces();
+            if (pos >= expression.size()) return true;
+            wchar_t op = expression.at(pos);
+            if (op != L'*' && op != L'/' && op != L'%') return true;
+            pos++;
+            math_number_t rhs;
+            if (!parse_power(&rhs)) return false;
+            if (op == L'*') {
+                math_number_t product = math_multiply(*out, rhs);
+                size_t max_scale = std::max(scale, std::max(out->scale, rhs.scale));
+                *out = with_scale(product, std::min(product.scale, max_scale));
+            } else if (op == L'/') {
+                if (!divide(*out, rhs, out)) return false;
+            } else {
+                if (!remainder(*out, rhs, out)) return false;
+            }
+            if (out->digits.size() > MATH_MAX_DIGITS) return fail(_(L"Result is too large"));
+        }
+    }
+
+    bool parse_sum(math_number_t *out) {
+        if (!parse_product(out)) return false;
+        for (;;) {
+            skip_spaces();
+            if (pos >= expression.size()) return true;
+            wchar_t op = expression.at(pos);
+            if (op != L'+' && op != L'-') return true;
+            pos++;
+            math_number_t rhs;
+            if (!parse_product(&rhs)) return false;
+            *out = math_add(*out, op == L'+' ? rhs : math_negate(rhs));
+        }
+    }
+
+   public:
+    math_evaluator_t(const wcstring &expr, size_t s)
+        : expression(expr), pos(0), scale(s), unsupported(false) {}
+
+    /// Evaluates the expression. Returns false and sets the error message on failure.
+    bool evaluate(math_number_t *out) {
+        if (!parse_sum(out)) return false;
+        skip_spaces();
+        if (pos < expression.size()) return fail_syntax();
+        return true;
+    }
+
+    const wcstring &error_message() const { return error; }
+
+    /// Returns whether evaluation failed because the expression uses something we don't implement,
+    /// as opposed to an error like division by zero that bc would also report.
+    bool failed_as_unsupported() const { return unsupported; }
+};
+
+/// Formats a number the way bc does: no leading zero before the decimal point, and trailing zeros
+/// kept to the number's scale.
+static wcstring format_math_number(const math_number_t &num) {
+    if (num.is_zero()) return L"0";
+    std::string padded = num.digits;
+    if (padded.size() < num.scale) padded.insert(0, num.scale - padded.size(), '0');
+    std::string result = num.negative ? "-" : "";
+    result.append(padded, 0, padded.size() - num.scale);
+    if (num.scale > 0) {
+        result.push_back('.');
+        result.append(padded, padded.size() - num.scale, num.scale);
+    }
+    return str2wcstring(result);
+}
+
+/// Evaluates an expression with bc, the way the math function did. Returns false without doing
+/// anything if bc can't be run, otherwise the status of the math builtin by reference.
+static bool math_with_bc(const wchar_t *cmd, io_streams_t &streams, size_t scale,
+                         const wcstring &expression, int *out_status) {
+    wcstring bc_path;
+    if (!path_get_path(L"bc", &bc_path)) return false;
+
+    std::string output, errors;
+    const wcstring input =
+        format_string(L"scale=%lu; %ls\n", (unsigned long)scale, expression.c_str());
+    const int status = exec_external_capture(bc_path, wcstring_list_t(1, L"bc"),
+                                             wcs2string(input), &output, &errors);
+    if (status == -1) return false;
+
+    // Stitch lines together manually. We can't rely on BC_LINE_LENGTH because some systems don't
+    // have a new enough version of bc.
+    std::string result;
+    const char *cursor = output.data();
+    const char *const end = cursor + output.size();
+    while (cursor < end) {
+        const char *line_end = std::find(cursor, end, '\n');
+        const char *content_end = line_end;
+        if (content_end > cursor && content_end[-1] == '\\') content_end--;
+        result.append(cursor, content_end);
+        cursor = line_end < end ? line_end + 1 : end;
+    }
+    if (!errors.empty()) streams.err.append(str2wcstring(errors));
+
+    if (WIFSIGNALED(status)) {
+        streams.err.append_format(_(L"%ls: bc was killed by signal %d\n"), cmd, WTERMSIG(status));
+        *out_status = MATH_STATUS_INVALID;
+    } else if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        streams.err.append_format(_(L"%ls: bc exited with status %d\n"), cmd,
+                                  WIFEXITED(status) ? WEXITSTATUS(status) : status);
+        *out_status = MATH_STATUS_INVALID;
+    } else if (result.empty()) {
+        // No output indicates an error occurred.
+        *out_status = MATH_STATUS_INVALID;
+    } else {
+        streams.out.append(str2wcstring(result));
+        streams.out.push_back(L'\n');
+        *out_status = result == "0" ? STATUS_BUILTIN_ERROR : STATUS_BUILTIN_OK;
+    }
+    return true;
+}
+
+/// The math builtin, for performing arithmetic on decimal numbers.
+int builtin_math(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
+    wchar_t *cmd = argv[0];
+    int argc = builtin_count_args(argv);
+    int argidx = 1;
+    size_t scale = 0;
+
+    // Options are parsed by hand, since negative numbers like `math -3 + 1` are not options.
+    if (argc > 1) {
+        const wchar_t *arg = argv[1];
+        if (string_prefixes_string(L"-s", arg)) {
+            const wchar_t *digits = arg + 2;
+            bool valid = *digits != L'\0';
+            for (const wchar_t *c = digits; *c && valid; c++) {
+                valid = *c >= L'0' && *c <= L'9';
+                scale = scale * 10 + (*c - L'0');
+                if (scale > MATH_MAX_DIGITS) valid = false;
+            }
+            if (!valid) {
+                streams.err.append_format(_(L"%ls: Expected an integer to follow -s\n"), cmd);
+                return MATH_STATUS_USAGE;
+            }
+            argidx++;
+        } else if (!wcscmp(arg, L"-h") ||
+                   (wcslen(arg) >= 3 && string_prefixes_string(arg, L"--help"))) {
+            builtin_print_help(parser, streams, cmd, streams.out);
+            return STATUS_BUILTIN_OK;
+        }
+    }
+
+    if (argidx >= argc) {
+        return MATH_STATUS_USAGE;
+    }
+
+    wcstring expression;
+    for (int i = argidx; i < argc; i++) {
+        if (i > argidx) expression.push_back(L' ');
+        expression.append(argv[i]);
+    }
+
+    math_number_t result;
+    math_evaluator_t evaluator(expression, scale);
+    if (!evaluator.evaluate(&result)) {
+        int status;
+        if (evaluator.failed_as_unsupported() &&
+            math_with_bc(cmd, streams, scale, expression, &status)) {
+            return status;
+        }
+        streams.err.append_format(L"%ls: %ls\n", cmd, evaluator.error_message().c_str());
+        return MATH_STATUS_INVALID;
+    }
+
+    // For historical reasons a zero result translates to a failure status.
+    streams.out.append(format_math_number(result));
+    streams.out.push_back(L'\n');
+    return result.is_zero() ? STATUS_BUILTIN_ERROR : STATUS_BUILTIN_OK;
+}
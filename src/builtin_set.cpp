@@ -46,7 +46,6 @@ static int my_env_set(const wchar_t *key, const wcstring_list_t &val, int scope,
                       io_streams_t &streams) {
     size_t i;
     int retcode = 0;
-    const wchar_t *val_str = NULL;
 
     if (is_path_variable(key)) {
         // Fix for https://github.com/fish-shell/fish-shell/issues/199 . Return success if any path
@@ -64,8 +63,7 @@ static int my_env_set(const wchar_t *key, const wcstring_list_t &val, int scope,
         // which don't start with /.
         wcstring_list_t existing_values;
         const env_var_t existing_variable = env_get_string(key, ENV_DEFAULT);
-        if (!existing_variable.missing_or_empty())
-            tokenize_variable_array(existing_variable, existing_values);
+        if (!existing_variable.missing_or_empty()) existing_values = existing_variable.as_list();
 
         for (i = 0; i < val.size(); i++) {
             const wcstring &dir = val.at(i);
@@ -111,18 +109,7 @@ static int my_env_set(const wchar_t *key, const wcstring_list_t &val, int scope,
         }
     }
 
-    wcstring sb;
-    if (!val.empty()) {
-        for (i = 0; i < val.size(); i++) {
-            sb.append(val[i]);
-            if (i < val.size() - 1) {
-                sb.append(ARRAY_SEP_STR);
-            }
-        }
-        val_str = sb.c_str();
-    }
-
-    switch (env_set(key, val_str, scope | ENV_USER)) {
+    switch (env_set(key, val, scope | ENV_USER)) {
         case ENV_OK: {
             break;
         }
@@ -289,10 +276,11 @@ static void print_variables(int include_values, int esc, bool shorten_ok, int sc
         streams.out.append(e_key);
 
         if (include_values) {
-            env_var_t value = env_get_string(key, scope);
-            if (!value.missing()) {
+            const env_var_t var = env_get_string(key, scope);
+            if (!var.missing()) {
                 int shorten = 0;
 
+                wcstring value = var;
                 if (shorten_ok && value.length() > 64) {
                     shorten = 1;
                     value.resize(60);
@@ -326,10 +314,12 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
                                            {L"universal", no_argument, 0, 'U'},
                                            {L"long", no_argument, 0, 'L'},
                                            {L"query", no_argument, 0, 'q'},
+                                           {L"append", no_argument, 0, 'a'},
+                                           {L"prepend", no_argument, 0, 'p'},
                                            {L"help", no_argument, 0, 'h'},
                                            {0, 0, 0, 0}};
 
-    const wchar_t *short_options = L"+xglenuULqh";
+    const wchar_t *short_options = L"+xglenuULqaph";
 
     int argc = builtin_count_args(argv);
 
@@ -337,6 +327,7 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
     int local = 0, global = 0, exportv = 0;
     int erase = 0, list = 0, unexport = 0;
     int universal = 0, query = 0;
+    int append = 0, prepend = 0;
     bool shorten_ok = true;
     bool preserve_failure_exit_status = true;
     const int incoming_exit_status = proc_get_last_status();
@@ -401,6 +392,14 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
                 preserve_failure_exit_status = false;
                 break;
             }
+            case 'a': {
+                append = 1;
+                break;
+            }
+            case 'p': {
+                prepend = 1;
+                break;
+            }
             case 'h': {
                 builtin_print_help(parser, streams, argv[0], streams.out);
                 return 0;
@@ -422,8 +421,9 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
         return 1;
     }
 
-    // We can't both list and erase variables.
-    if (erase && list) {
+    // We can't both list and erase variables, and can only add values when setting them.
+    if ((erase && list) || (append && prepend) ||
+        ((append || prepend) && (erase || list || query))) {
         streams.err.append_format(BUILTIN_ERR_COMBO, argv[0]);
 
         builtin_print_help(parser, streams, argv[0], streams.err);
@@ -447,6 +447,7 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
     // Calculate the scope value for variable assignement.
     scope = (local ? ENV_LOCAL : 0) | (global ? ENV_GLOBAL : 0) | (exportv ? ENV_EXPORT : 0) |
             (unexport ? ENV_UNEXPORT : 0) | (universal ? ENV_UNIVERSAL : 0) | ENV_USER;
+    const int add_mode = (append ? ENV_APPEND : 0) | (prepend ? ENV_PREPEND : 0);
 
     if (query) {
         // Query mode. Return the number of variables that do not exist out of the specified
@@ -471,7 +472,7 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
                 size_t j;
 
                 env_var_t dest_str = env_get_string(dest, scope);
-                if (!dest_str.missing()) tokenize_variable_array(dest_str, result);
+                if (!dest_str.missing()) result = dest_str.as_list();
 
                 if (!parse_index(indexes, arg, dest, result.size(), streams)) {
                     builtin_print_help(parser, streams, argv[0], streams.err);
@@ -531,6 +532,14 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
         return STATUS_BUILTIN_ERROR;
     }
 
+    // Values can't be added to slices.
+    if (slice && add_mode) {
+        streams.err.append_format(BUILTIN_ERR_COMBO, argv[0]);
+        builtin_print_help(parser, streams, argv[0], streams.err);
+        free(dest);
+        return 1;
+    }
+
     // Set assignment can work in two modes, either using slices or using the whole array. We detect
     // which mode is used here.
     if (slice) {
@@ -540,7 +549,7 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
 
         const env_var_t dest_str = env_get_string(dest, scope);
         if (!dest_str.missing()) {
-            tokenize_variable_array(dest_str, result);
+            result = dest_str.as_list();
         } else if (erase) {
             retcode = 1;
         }
@@ -607,14 +616,13 @@ int builtin_set(parser_t &parser, io_streams_t &streams, wchar_t **argv) {
         } else {
             wcstring_list_t val;
             for (int i = w.woptind; i < argc; i++) val.push_back(argv[i]);
-            retcode = my_env_set(dest, val, scope, streams);
+            retcode = my_env_set(dest, val, scope | add_mode, streams);
         }
     }
 
     // Check if we are setting variables above the effective scope. See
     // https://github.com/fish-shell/fish-shell/issues/806
-    env_var_t global_dest = env_get_string(dest, ENV_GLOBAL);
-    if (universal && !global_dest.missing()) {
+    if (universal && env_exist(dest, ENV_GLOBAL)) {
         streams.err.append_format(
             _(L"%ls: Warning: universal scope selected, but a global variable '%ls' exists.\n"),
             L"set", dest);
@@ -16,6 +16,18 @@
 #include <sstream>
 #include <string>
 #include <vector>
+// Note that we have to include something to get any _LIBCPP_VERSION defined so we can detect libc++
+// So it's key that vector go above. If we didn't need vector for other reasons, we might include
+// ciso646, which does nothing
+#if defined(_LIBCPP_VERSION) || __cplusplus > 199711L
+// C++11 or libc++ (which is a C++11-only library, but the memory header works OK in C++03)
+#include <memory>
+using std::shared_ptr;
+#else
+// C++03 or libstdc++
+#include <tr1/memory>
+using std::tr1::shared_ptr;
+#endif
 
 #include "fallback.h"  // IWYU pragma: keep
 #include "signal.h"    // IWYU pragma: keep
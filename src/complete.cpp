@@ -504,7 +504,7 @@ void complete_remove_all(const wcstring &cmd, bool cmd_is_path) {
 
 /// Find the full path and commandname from a command string 'str'.
 static void parse_cmd_string(const wcstring &str, wcstring &path, wcstring &cmd) {
-    if (!path_get_path(str, &path)) {
+    if (!path_get_path_cached(str, &path)) {
         /// Use the empty string as the 'path' for commands that can not be found.
         path = L"";
     }
@@ -37,7 +37,7 @@
 #include "sanity.h"
 #include "wutil.h"  // IWYU pragma: keep
 
-/// Value denoting a null string.
+/// Value denoting a null string. Universal variables store a list with no elements as this.
 #define ENV_NULL L"\x1d"
 
 /// Some configuration path environment variables.
@@ -63,8 +63,13 @@ struct env_node_t {
     bool exportv;
     /// Pointer to next level.
     struct env_node_t *next;
+    /// Number of nodes below this one. The global node has depth 0.
+    size_t depth;
+    /// Depth of the innermost node at or below this one that has new_scope set, or 0 if there is
+    /// none. Non-global variables in nodes deeper than that are invisible from this node.
+    size_t scope_depth;
 
-    env_node_t() : new_scope(false), exportv(false), next(NULL) {}
+    env_node_t() : new_scope(false), exportv(false), next(NULL), depth(0), scope_depth(0) {}
 
     /// Returns a pointer to the given entry if present, or NULL.
     const var_entry_t *find_entry(const wcstring &key);
@@ -75,10 +80,6 @@ struct env_node_t {
     const env_node_t *next_scope_to_search() const;
 };
 
-class variable_entry_t {
-    wcstring value; /**< Value of the variable */
-};
-
 static pthread_mutex_t env_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /// Top node on the function stack.
@@ -96,6 +97,46 @@ static env_universal_t *uvars() { return s_universal_variables; }
 /// Table for global variables.
 static var_table_t *global;
 
+/// Maps the name of each variable to the nodes that define it, from the outermost to the innermost.
+/// This lets lookups find the innermost visible definition without searching every scope. Modified
+/// only on the main thread, with env_lock held.
+typedef std::map<wcstring, std::vector<env_node_t *> > var_index_t;
+static var_index_t var_index;
+
+/// Records that node defines key.
+static void index_add(const wcstring &key, env_node_t *node) {
+    ASSERT_IS_LOCKED(env_lock);
+    std::vector<env_node_t *> &nodes = var_index[key];
+    std::vector<env_node_t *>::iterator pos = nodes.end();
+    while (pos != nodes.begin() && (*(pos - 1))->depth > node->depth) --pos;
+    nodes.insert(pos, node);
+}
+
+/// Records that node no longer defines key.
+static void index_remove(const wcstring &key, env_node_t *node) {
+    ASSERT_IS_LOCKED(env_lock);
+    var_index_t::iterator where = var_index.find(key);
+    assert(where != var_index.end());
+    std::vector<env_node_t *> &nodes = where->second;
+    // The node is usually the innermost one, e.g. when popping a scope, so search from the back.
+    std::vector<env_node_t *>::reverse_iterator node_pos =
+        std::find(nodes.rbegin(), nodes.rend(), node);
+    assert(node_pos != nodes.rend());
+    nodes.erase(node_pos.base() - 1);
+    if (nodes.empty()) var_index.erase(where);
+}
+
+/// Returns the innermost node visible from the top of the stack that defines key, or NULL if there
+/// is none. This is the node that a search through all scopes with next_scope_to_search would find.
+static env_node_t *visible_node(const wcstring &key) {
+    var_index_t::const_iterator where = var_index.find(key);
+    if (where == var_index.end()) return NULL;
+    const std::vector<env_node_t *> &nodes = where->second;
+    if (nodes.back()->depth >= top->scope_depth) return nodes.back();
+    // The innermost definition is shadowed by a new scope, so only a global one is visible.
+    return nodes.front() == global_env ? global_env : NULL;
+}
+
 // Helper class for storing constant strings, without needing to wrap them in a wcstring.
 
 // Comparer for const string set.
@@ -118,12 +159,21 @@ static bool is_electric(const wcstring &key) {
     return env_electric.find(key.c_str()) != env_electric.end();
 }
 
-/// Exported variable array used by execv.
-static null_terminated_array_t<char> export_array;
+/// The environment of child processes, as encoded "NAME=value" strings keyed by variable name. It
+/// is patched one variable at a time as exported variables change.
+static std::map<wcstring, std::string> export_table;
+
+/// Exported variable array used by execv. Points into the strings in export_table.
+static std::vector<const char *> export_array;
 
-/// Flag for checking if we need to regenerate the exported variable array.
+/// Names of variables whose entry in export_table may be out of date.
+static std::set<wcstring> changed_exports;
+
+/// Flag for checking if we need to regenerate all of export_table, because a change such as
+/// entering a function affects the visibility of many exported variables.
 static bool has_changed_exported = true;
 static void mark_changed_exported() { has_changed_exported = true; }
+static void mark_changed_exported(const wcstring &key) { changed_exports.insert(key); }
 
 /// List of all locale environment variable names.
 static const wchar_t *const locale_variable[] = {
@@ -263,9 +313,20 @@ static void react_to_variable_change(const wcstring &key) {
         reader_react_to_color_change();
     } else if (key == L"fish_escape_delay_ms") {
         update_wait_on_escape_ms();
+    } else if (key == USER_ABBREVIATIONS_VARIABLE_NAME) {
+        expand_abbreviations_changed();
     }
 }
 
+/// Returns whether react_to_variable_change does anything for the given variable. Keep this in sync
+/// with it.
+static bool variable_change_has_side_effects(const wcstring &key) {
+    return var_is_locale(key) || var_is_curses(key) || var_is_timezone(key) ||
+           key == L"fish_term256" || key == L"fish_term24bit" ||
+           string_prefixes_string(L"fish_color_", key) || key == L"fish_escape_delay_ms" ||
+           key == USER_ABBREVIATIONS_VARIABLE_NAME;
+}
+
 /// Universal variable callback function. This function makes sure the proper events are triggered
 /// when an event occurs.
 static void universal_callback(fish_message_type_t type, const wchar_t *name) {
@@ -284,7 +345,7 @@ static void universal_callback(fish_message_type_t type, const wchar_t *name) {
     }
 
     if (str) {
-        mark_changed_exported();
+        mark_changed_exported(name);
 
         event_t ev = event_t::variable_event(name);
         ev.arguments.push_back(L"VARIABLE");
@@ -317,10 +378,11 @@ int env_set_pwd() {
 }
 
 wcstring env_get_pwd_slash(void) {
-    env_var_t pwd = env_get_string(L"PWD");
-    if (pwd.missing_or_empty()) {
+    const env_var_t pwd_var = env_get_string(L"PWD");
+    if (pwd_var.missing_or_empty()) {
         return L"";
     }
+    wcstring pwd = pwd_var;
     if (!string_suffixes_string(L"/", pwd)) {
         pwd.push_back(L'/');
     }
@@ -456,20 +518,6 @@ void env_init(const struct config_paths_t *paths /* or NULL */) {
     env_push(false);
 }
 
-/// Search all visible scopes in order for the specified key. Return the first scope in which it was
-/// found.
-static env_node_t *env_get_node(const wcstring &key) {
-    env_node_t *env = top;
-    while (env != NULL) {
-        if (env->find_entry(key) != NULL) {
-            break;
-        }
-
-        env = env->next_scope_to_search();
-    }
-    return env;
-}
-
 /// Set the value of the environment variable whose name matches key to val.
 ///
 /// Memory policy: All keys and values are copied, the parameters can and should be freed by the
@@ -490,12 +538,58 @@ static env_node_t *env_get_node(const wcstring &key) {
 /// variables set from the local or universal scopes, or set as exported.
 /// * ENV_INVALID, the variable value was invalid. This applies only to special variables.
 int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode) {
+    wcstring_list_t vals;
+    if (val) tokenize_variable_array(val, vals);
+    return env_set(key, vals, var_mode);
+}
+
+/// Joins the elements of a list with ARRAY_SEP.
+static wcstring join_variable_array(const wcstring_list_t &vals) {
+    wcstring result;
+    for (size_t i = 0; i < vals.size(); i++) {
+        if (i > 0) result.push_back(ARRAY_SEP);
+        result.append(vals[i]);
+    }
+    return result;
+}
+
+/// Adds the elements of vals to the start or the end of the list out, according to ENV_APPEND or
+/// ENV_PREPEND in mode, or replaces out with them if neither is set.
+static void apply_values(wcstring_list_t &out, const wcstring_list_t &vals, env_mode_flags_t mode) {
+    if (mode & ENV_APPEND) {
+        out.insert(out.end(), vals.begin(), vals.end());
+    } else if (mode & ENV_PREPEND) {
+        out.insert(out.begin(), vals.begin(), vals.end());
+    } else {
+        out = vals;
+    }
+}
+
+/// Returns the string to store in the universal variable key for the given values. Universal
+/// variables are stored joined.
+static wcstring universal_value(const wcstring &key, const wcstring_list_t &vals,
+                                env_mode_flags_t mode) {
+    wcstring_list_t result;
+    if (mode & (ENV_APPEND | ENV_PREPEND)) {
+        env_var_t existing = uvars()->get(key);
+        if (existing.missing()) existing = env_get_string(key);
+        if (!existing.missing() && existing != ENV_NULL) result = existing.as_list();
+    }
+    apply_values(result, vals, mode);
+    return result.empty() ? wcstring(ENV_NULL) : join_variable_array(result);
+}
+
+int env_set(const wcstring &key, const wcstring_list_t &vals, env_mode_flags_t var_mode) {
     ASSERT_IS_MAIN_THREAD();
-    bool has_changed_old = has_changed_exported;
     int done = 0;
+    // Adding to a variable starts from its value in the scope it is set in. If it is not set in
+    // that scope, as in `set -l -a PATH /foo` in a function, it starts from the visible value.
+    const env_mode_flags_t add_mode = var_mode & (ENV_APPEND | ENV_PREPEND);
+    const bool adding = add_mode != 0;
 
-    if (val && contains(key, L"PWD", L"HOME")) {
+    if (!vals.empty() && contains(key, L"PWD", L"HOME")) {
         // Canonicalize our path; if it changes, recurse and try again.
+        const wcstring val = join_variable_array(vals);
         wcstring val_canonical = val;
         path_make_canonical(val_canonical);
         if (val != val_canonical) {
@@ -517,9 +611,10 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
         wchar_t *end;
 
         // Set the new umask.
-        if (val && wcslen(val)) {
+        const wcstring val = join_variable_array(vals);
+        if (!adding && !val.empty()) {
             errno = 0;
-            long mask = wcstol(val, &end, 8);
+            long mask = wcstol(val.c_str(), &end, 8);
 
             if (!errno && (!*end) && (mask <= 0777) && (mask >= 0)) {
                 umask(mask);
@@ -532,11 +627,6 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
         return ENV_INVALID;
     }
 
-    // Zero element arrays are internaly not coded as null but as this placeholder string.
-    if (!val) {
-        val = ENV_NULL;  //!OCLINT(parameter reassignment)
-    }
-
     if (var_mode & ENV_UNIVERSAL) {
         const bool old_export = uvars() && uvars()->get_export(key);
         bool new_export;
@@ -551,16 +641,16 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
             new_export = old_export;
         }
         if (uvars()) {
-            uvars()->set(key, val, new_export);
+            uvars()->set(key, universal_value(key, vals, add_mode), new_export);
             env_universal_barrier();
             if (old_export || new_export) {
-                mark_changed_exported();
+                mark_changed_exported(key);
             }
         }
     } else {
         // Determine the node.
         bool has_changed_new = false;
-        env_node_t *preexisting_node = env_get_node(key);
+        env_node_t *preexisting_node = visible_node(key);
         bool preexisting_entry_exportv = false;
         if (preexisting_node != NULL) {
             var_table_t::const_iterator result = preexisting_node->env.find(key);
@@ -591,6 +681,7 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
             }
 
             if (uvars() && !uvars()->get(key).missing()) {
+                const bool old_export = uvars()->get_export(key);
                 bool exportv;
                 if (var_mode & ENV_EXPORT) {
                     exportv = true;
@@ -600,8 +691,9 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
                     exportv = uvars()->get_export(key);
                 }
 
-                uvars()->set(key, val, exportv);
+                uvars()->set(key, universal_value(key, vals, add_mode), exportv);
                 env_universal_barrier();
+                if (old_export || exportv) mark_changed_exported(key);
 
                 done = 1;
 
@@ -616,14 +708,32 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
         }
 
         if (!done) {
+            // Background threads take the elements of variables under the lock, so hold it while
+            // deciding whether they can be modified in place.
+            scoped_lock locker(env_lock);
+
             // Set the entry in the node. Note that operator[] accesses the existing entry, or
             // creates a new one.
+            const bool new_entry = node->env.find(key) == node->env.end();
+            shared_ptr<wcstring_list_t> visible_vals;
+            if (adding && preexisting_node != NULL && new_entry) {
+                visible_vals = preexisting_node->env[key].vals;
+            }
+            if (new_entry) index_add(key, node);
+
             var_entry_t &entry = node->env[key];
             if (entry.exportv) {
                 // This variable already existed, and was exported.
                 has_changed_new = true;
             }
-            entry.val = val;
+            if (visible_vals) entry.vals = visible_vals;
+            if (!adding || !entry.vals) {
+                entry.vals.reset(new wcstring_list_t(vals));
+            } else {
+                // Values handed out by env_get_string must not change, so copy shared elements.
+                if (!entry.vals.unique()) entry.vals.reset(new wcstring_list_t(*entry.vals));
+                apply_values(*entry.vals, vals, add_mode);
+            }
             if (var_mode & ENV_EXPORT) {
                 // The new variable is exported.
                 entry.exportv = true;
@@ -633,7 +743,7 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
                 entry.exportv = false;
             }
 
-            if (has_changed_old || has_changed_new) mark_changed_exported();
+            if (has_changed_new) mark_changed_exported(key);
         }
     }
 
@@ -651,6 +761,29 @@ int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t var_mode)
     return ENV_OK;
 }
 
+bool env_set_loop_var(const wcstring &key, const wcstring &val) {
+    ASSERT_IS_MAIN_THREAD();
+    var_table_t::iterator where = top->env.find(key);
+    if (where == top->env.end() || where->second.exportv) return false;
+    // env_set splits values at ARRAY_SEP.
+    if (val.find(ARRAY_SEP) != wcstring::npos) return false;
+    if (variable_change_has_side_effects(key)) return false;
+    if (event_get(event_t::variable_event(key), NULL) > 0) return false;
+
+    var_entry_t &entry = where->second;
+    scoped_lock locker(env_lock);
+    if (entry.vals && entry.vals.unique() && entry.vals->size() == 1) {
+        entry.vals->front() = val;
+    } else {
+        entry.vals.reset(new wcstring_list_t(1, val));
+    }
+    locker.unlock();
+
+    // env_set would also fire events delivered by signals, through event_fire.
+    event_fire(NULL);
+    return true;
+}
+
 /// Attempt to remove/free the specified key/value pair from the specified map.
 ///
 /// \return zero if the variable was not found, non-zero otherwise
@@ -662,8 +795,10 @@ static bool try_remove(env_node_t *n, const wchar_t *key, int var_mode) {
     var_table_t::iterator result = n->env.find(key);
     if (result != n->env.end()) {
         if (result->second.exportv) {
-            mark_changed_exported();
+            mark_changed_exported(key);
         }
+        scoped_lock locker(env_lock);
+        index_remove(key, n);
         n->env.erase(result);
         return true;
     }
@@ -717,7 +852,7 @@ int env_remove(const wcstring &key, int var_mode) {
             event_fire(&ev);
         }
 
-        if (is_exported) mark_changed_exported();
+        if (is_exported) mark_changed_exported(key);
     }
 
     react_to_variable_change(key);
@@ -725,9 +860,31 @@ int env_remove(const wcstring &key, int var_mode) {
     return !erased;
 }
 
+bool env_var_t::empty(void) const {
+    if (joined) return joined->empty();
+    if (!vals) return true;
+    return vals->empty() || (vals->size() == 1 && vals->front().empty());
+}
+
+const wcstring &env_var_t::as_string(void) const {
+    if (!joined) {
+        joined.reset(vals ? new wcstring(join_variable_array(*vals)) : new wcstring());
+    }
+    return *joined;
+}
+
+const wcstring_list_t &env_var_t::as_list(void) const {
+    if (!vals) {
+        wcstring_list_t *list = new wcstring_list_t();
+        if (!is_missing) tokenize_variable_array(joined ? *joined : wcstring(), *list);
+        vals.reset(list);
+    }
+    return *vals;
+}
+
 const wchar_t *env_var_t::c_str(void) const {
     assert(!is_missing);  //!OCLINT(multiple unary operator)
-    return wcstring::c_str();
+    return as_string().c_str();
 }
 
 env_var_t env_get_string(const wcstring &key, env_mode_flags_t mode) {
@@ -746,7 +903,7 @@ env_var_t env_get_string(const wcstring &key, env_mode_flags_t mode) {
         // Big hack. We only allow getting the history on the main thread. Note that history_t may
         // ask for an environment variable, so don't take the lock here (we don't need it).
         if (key == L"history" && is_main_thread()) {
-            env_var_t result;
+            wcstring result;
 
             history_t *history = reader_get_history();
             if (!history) {
@@ -770,15 +927,17 @@ env_var_t env_get_string(const wcstring &key, env_mode_flags_t mode) {
         /* Lock around a local region */
         scoped_lock locker(env_lock);
 
-        env_node_t *env = search_local ? top : global_env;
+        // Without a scope all visible scopes are searched, so start at the innermost one that
+        // defines the variable.
+        env_node_t *env = has_scope ? (search_local ? top : global_env) : visible_node(key);
 
         while (env != NULL) {
             const var_entry_t *entry = env->find_entry(key);
             if (entry != NULL && (entry->exportv ? search_exported : search_unexported)) {
-                if (entry->val == ENV_NULL) {
+                if (!entry->vals || entry->vals->empty()) {
                     return env_var_t::missing_var();
                 }
-                return entry->val;
+                return env_var_t(shared_ptr<const wcstring_list_t>(entry->vals));
             }
 
             if (has_scope) {
@@ -831,18 +990,17 @@ bool env_exist(const wchar_t *key, env_mode_flags_t mode) {
     }
 
     if (test_local || test_global) {
-        const env_node_t *env = test_local ? top : global_env;
-        while (env != NULL) {
-            if (env == global_env && !test_global) {
-                break;
-            }
+        const env_node_t *env = test_local ? visible_node(key) : global_env;
+        if (env == global_env && !test_global) {
+            env = NULL;
+        }
 
+        if (env != NULL) {
             var_table_t::const_iterator result = env->env.find(key);
             if (result != env->env.end()) {
                 const var_entry_t &res = result->second;
                 return res.exportv ? test_exported : test_unexported;
             }
-            env = env->next_scope_to_search();
         }
     }
 
@@ -876,9 +1034,19 @@ void env_push(bool new_scope) {
     env_node_t *node = new env_node_t;
     node->next = top;
     node->new_scope = new_scope;
+    node->depth = top->depth + 1;
+    node->scope_depth = new_scope ? node->depth : top->scope_depth;
 
     if (new_scope && local_scope_exports(top)) mark_changed_exported();
+    const env_node_t *abbreviations_node = visible_node(USER_ABBREVIATIONS_VARIABLE_NAME);
+    scoped_lock locker(env_lock);
     top = node;
+    locker.unlock();
+
+    // A new scope may hide the abbreviations of its caller.
+    if (visible_node(USER_ABBREVIATIONS_VARIABLE_NAME) != abbreviations_node) {
+        expand_abbreviations_changed();
+    }
 }
 
 void env_pop() {
@@ -895,24 +1063,27 @@ void env_pop() {
             }
         }
 
-        if (killme->new_scope) {  //!OCLINT(collapsible if statements)
-            if (killme->exportv || local_scope_exports(killme->next)) mark_changed_exported();
-        }
+        // Leaving a function makes the exported variables of its caller visible again.
+        if (killme->new_scope && local_scope_exports(killme->next)) mark_changed_exported();
+        const env_node_t *abbreviations_node = visible_node(USER_ABBREVIATIONS_VARIABLE_NAME);
 
+        scoped_lock locker(env_lock);
         top = top->next;
 
         var_table_t::iterator iter;
         for (iter = killme->env.begin(); iter != killme->env.end(); ++iter) {
             const var_entry_t &entry = iter->second;
-            if (entry.exportv) {
-                mark_changed_exported();
-                break;
-            }
+            if (entry.exportv) mark_changed_exported(iter->first);
+            index_remove(iter->first, killme);
         }
+        bool abbreviations_changed =
+            visible_node(USER_ABBREVIATIONS_VARIABLE_NAME) != abbreviations_node;
 
         delete killme;
+        locker.unlock();
 
         if (locale_changed) handle_locale(locale_changed);
+        if (abbreviations_changed) expand_abbreviations_changed();
 
     } else {
         debug(0, _(L"Tried to pop empty environment stack."));
@@ -993,10 +1164,10 @@ static void get_exported(const env_node_t *n, std::map<wcstring, wcstring> *h) {
         const wcstring &key = iter->first;
         const var_entry_t &val_entry = iter->second;
 
-        if (val_entry.exportv && val_entry.val != ENV_NULL) {
+        if (val_entry.exportv && val_entry.vals && !val_entry.vals->empty()) {
             // Export the variable. Don't use std::map::insert here, since we need to overwrite
             // existing values from previous scopes.
-            (*h)[key] = val_entry.val;
+            (*h)[key] = join_variable_array(*val_entry.vals);
         } else {
             // We need to erase from the map if we are not exporting, since a lower scope may have
             // exported. See #2132.
@@ -1006,31 +1177,45 @@ static void get_exported(const env_node_t *n, std::map<wcstring, wcstring> *h) {
 }
 
 // Given a map from key to value, add values to out of the form key=value.
-static void export_func(const std::map<wcstring, wcstring> &envs, std::vector<std::string> &out) {
-    out.reserve(out.size() + envs.size());
-    std::map<wcstring, wcstring>::const_iterator iter;
-    for (iter = envs.begin(); iter != envs.end(); ++iter) {
-        const wcstring &key = iter->first;
-        const std::string &ks = wcs2string(key);
-        std::string vs = wcs2string(iter->second);
-
-        // Arrays in the value are ASCII record separator (0x1e) delimited. But some variables
-        // should have colons. Add those.
-        if (variable_is_colon_delimited_array(key)) {
-            // Replace ARRAY_SEP with colon.
-            std::replace(vs.begin(), vs.end(), (char)ARRAY_SEP, ':');
-        }
+/// Returns the "NAME=value" string that exports the given value of a variable to child processes.
+static std::string export_string(const wcstring &key, const wcstring &val) {
+    const std::string &ks = wcs2string(key);
+    std::string vs = wcs2string(val);
+
+    // Arrays in the value are ASCII record separator (0x1e) delimited. But some variables
+    // should have colons. Add those.
+    if (variable_is_colon_delimited_array(key)) {
+        // Replace ARRAY_SEP with colon.
+        std::replace(vs.begin(), vs.end(), (char)ARRAY_SEP, ':');
+    }
 
-        // Put a string on the vector.
-        out.push_back(std::string());
-        std::string &str = out.back();
-        str.reserve(ks.size() + 1 + vs.size());
+    std::string str;
+    str.reserve(ks.size() + 1 + vs.size());
+    str.append(ks);
+    str.append("=");
+    str.append(vs);
+    return str;
+}
 
-        // Append our environment variable data to it.
-        str.append(ks);
-        str.append("=");
-        str.append(vs);
+/// Gets the value of key exported to child processes. This agrees with what get_exported and the
+/// universal variables give when regenerating the whole table: the innermost visible definition
+/// wins if it is exported and not empty, otherwise an exported universal variable is used.
+static bool get_exported_value(const wcstring &key, wcstring *out) {
+    env_node_t *node = visible_node(key);
+    const var_entry_t *entry = node ? node->find_entry(key) : NULL;
+    if (entry != NULL && entry->exportv && entry->vals && !entry->vals->empty()) {
+        *out = join_variable_array(*entry->vals);
+        return true;
     }
+
+    if (uvars() && uvars()->get_export(key)) {
+        const env_var_t val = uvars()->get(key);
+        if (!val.missing() && val != ENV_NULL) {
+            *out = val.as_string();
+            return true;
+        }
+    }
+    return false;
 }
 
 static void update_export_array_if_necessary(bool recalc) {
@@ -1040,6 +1225,7 @@ static void update_export_array_if_necessary(bool recalc) {
         env_universal_barrier();
     }
 
+    bool changed = false;
     if (has_changed_exported) {
         std::map<wcstring, wcstring> vals;
 
@@ -1056,40 +1242,62 @@ static void update_export_array_if_necessary(bool recalc) {
                 if (!val.missing() && val != ENV_NULL) {
                     // Note that std::map::insert does NOT overwrite a value already in the map,
                     // which we depend on here.
-                    vals.insert(std::pair<wcstring, wcstring>(key, val));
+                    vals.insert(std::pair<wcstring, wcstring>(key, val.as_string()));
                 }
             }
         }
 
-        std::vector<std::string> local_export_buffer;
-        export_func(vals, local_export_buffer);
-        export_array.set(local_export_buffer);
+        export_table.clear();
+        std::map<wcstring, wcstring>::const_iterator iter;
+        for (iter = vals.begin(); iter != vals.end(); ++iter) {
+            export_table[iter->first] = export_string(iter->first, iter->second);
+        }
         has_changed_exported = false;
+        changed_exports.clear();
+        changed = true;
+    } else if (!changed_exports.empty()) {
+        // Only re-encode the variables that changed.
+        std::set<wcstring>::const_iterator iter;
+        for (iter = changed_exports.begin(); iter != changed_exports.end(); ++iter) {
+            const wcstring &key = *iter;
+            wcstring val;
+            if (get_exported_value(key, &val)) {
+                std::string str = export_string(key, val);
+                std::string &existing = export_table[key];
+                if (existing != str) {
+                    existing.swap(str);
+                    changed = true;
+                }
+            } else if (export_table.erase(key) > 0) {
+                changed = true;
+            }
+        }
+        changed_exports.clear();
+    }
+
+    if (changed) {
+        export_array.clear();
+        export_array.reserve(export_table.size() + 1);
+        std::map<wcstring, std::string>::const_iterator iter;
+        for (iter = export_table.begin(); iter != export_table.end(); ++iter) {
+            export_array.push_back(iter->second.c_str());
+        }
+        export_array.push_back(NULL);
     }
 }
 
 const char *const *env_export_arr(bool recalc) {
     ASSERT_IS_MAIN_THREAD();
     update_export_array_if_necessary(recalc);
-    return export_array.get();
+    return &export_array[0];
 }
 
 void env_set_argv(const wchar_t *const *argv) {
-    if (*argv) {
-        const wchar_t *const *arg;
-        wcstring sb;
-
-        for (arg = argv; *arg; arg++) {
-            if (arg != argv) {
-                sb.append(ARRAY_SEP_STR);
-            }
-            sb.append(*arg);
-        }
-
-        env_set(L"argv", sb.c_str(), ENV_LOCAL);
-    } else {
-        env_set(L"argv", 0, ENV_LOCAL);
+    wcstring_list_t vals;
+    for (const wchar_t *const *arg = argv; *arg; arg++) {
+        vals.push_back(*arg);
     }
+    env_set(L"argv", vals, ENV_LOCAL);
 }
 
 env_vars_snapshot_t::env_vars_snapshot_t(const wchar_t *const *keys) {
@@ -1135,8 +1343,8 @@ env_var_t env_vars_snapshot_t::get(const wcstring &key) const {
     if (this->is_current()) {
         return env_get_string(key);
     }
-    std::map<wcstring, wcstring>::const_iterator iter = vars.find(key);
-    return iter == vars.end() ? env_var_t::missing_var() : env_var_t(iter->second);
+    std::map<wcstring, env_var_t>::const_iterator iter = vars.find(key);
+    return iter == vars.end() ? env_var_t::missing_var() : iter->second;
 }
 
 const wchar_t *const env_vars_snapshot_t::highlighting_keys[] = {L"PATH", L"CDPATH",
@@ -32,7 +32,15 @@ enum {
     ENV_USER = 8,
 
     /// Flag for universal variable.
-    ENV_UNIVERSAL = 32
+    ENV_UNIVERSAL = 32,
+
+    /// Flag for adding the values to the end of the variable instead of replacing it. Only
+    /// meaningful to env_set.
+    ENV_APPEND = 64,
+
+    /// Flag for adding the values to the start of the variable instead of replacing it. Only
+    /// meaningful to env_set.
+    ENV_PREPEND = 128
 };
 typedef uint32_t env_mode_flags_t;
 
@@ -51,52 +59,77 @@ struct config_paths_t {
 /// Initialize environment variable data.
 void env_init(const struct config_paths_t *paths = NULL);
 
+/// Sets a variable to the elements of val, which are separated with ARRAY_SEP. A NULL val sets the
+/// variable to a list with no elements.
 int env_set(const wcstring &key, const wchar_t *val, env_mode_flags_t mode);
 
-class env_var_t : public wcstring {
+/// Sets a variable to the given list of elements.
+int env_set(const wcstring &key, const wcstring_list_t &vals, env_mode_flags_t mode);
+
+/// Sets a variable in the innermost scope to val, like env_set(key, val.c_str(), ENV_LOCAL) but
+/// without its overhead. Used for the variable of a for loop. Does nothing and returns false if the
+/// variable is not already set in the innermost scope, is exported, or if setting it must fire
+/// events or has other side effects. Then env_set must be used instead.
+bool env_set_loop_var(const wcstring &key, const wcstring &val);
+
+/// The value of a variable. Variables are lists of elements. The value can also be used as one
+/// string with the elements separated by ARRAY_SEP, which is computed the first time it is needed.
+///
+/// The elements and the joined string are immutable and shared between copies, so values are cheap
+/// to copy: env_get_string hands out the same elements the variable is stored with.
+class env_var_t {
    private:
+    // The elements, or NULL if they have not been computed from joined yet.
+    mutable shared_ptr<const wcstring_list_t> vals;
+    // The elements joined with ARRAY_SEP, or NULL if they have not been joined yet. If both are
+    // NULL the value is the empty string.
+    mutable shared_ptr<const wcstring> joined;
     bool is_missing;
 
    public:
     static env_var_t missing_var() {
-        env_var_t result((wcstring()));
+        env_var_t result;
         result.is_missing = true;
         return result;
     }
 
-    env_var_t(const env_var_t &x) : wcstring(x), is_missing(x.is_missing) {}
-    env_var_t(const wcstring &x) : wcstring(x), is_missing(false) {}
-    env_var_t(const wchar_t *x) : wcstring(x), is_missing(false) {}
-    env_var_t() : wcstring(L""), is_missing(false) {}
+    env_var_t(const wcstring &x) : vals(), joined(new wcstring(x)), is_missing(false) {}
+    env_var_t(const wchar_t *x) : vals(), joined(new wcstring(x)), is_missing(false) {}
+    explicit env_var_t(const wcstring_list_t &x)
+        : vals(new wcstring_list_t(x)), joined(), is_missing(false) {}
+    /// Shares the given elements, which must not be modified afterwards.
+    explicit env_var_t(const shared_ptr<const wcstring_list_t> &x)
+        : vals(x), joined(), is_missing(false) {}
+    env_var_t() : vals(), joined(), is_missing(false) {}
 
     bool missing(void) const { return is_missing; }
 
     bool missing_or_empty(void) const { return missing() || empty(); }
 
+    /// Returns whether the value is empty when joined, i.e. it has no elements or one empty one.
+    bool empty(void) const;
+
+    /// Returns the elements joined with ARRAY_SEP.
+    const wcstring &as_string(void) const;
+
+    /// Returns the elements.
+    const wcstring_list_t &as_list(void) const;
+
     const wchar_t *c_str(void) const;
 
-    env_var_t &operator=(const env_var_t &s) {
-        is_missing = s.is_missing;
-        wcstring::operator=(s);
-        return *this;
-    }
+    operator const wcstring &() const { return as_string(); }
 
     bool operator==(const env_var_t &s) const {
-        return is_missing == s.is_missing &&
-               static_cast<const wcstring &>(*this) == static_cast<const wcstring &>(s);
+        return is_missing == s.is_missing && as_string() == s.as_string();
     }
 
-    bool operator==(const wcstring &s) const {
-        return !is_missing && static_cast<const wcstring &>(*this) == s;
-    }
+    bool operator==(const wcstring &s) const { return !is_missing && as_string() == s; }
 
     bool operator!=(const env_var_t &s) const { return !(*this == s); }
 
     bool operator!=(const wcstring &s) const { return !(*this == s); }
 
-    bool operator==(const wchar_t *s) const {
-        return !is_missing && static_cast<const wcstring &>(*this) == s;
-    }
+    bool operator==(const wchar_t *s) const { return !is_missing && as_string() == s; }
 
     bool operator!=(const wchar_t *s) const { return !(*this == s); }
 };
@@ -150,7 +183,7 @@ int env_set_pwd();
 wcstring env_get_pwd_slash();
 
 class env_vars_snapshot_t {
-    std::map<wcstring, wcstring> vars;
+    std::map<wcstring, env_var_t> vars;
     bool is_current() const;
 
     env_vars_snapshot_t(const env_vars_snapshot_t &);
@@ -177,7 +210,9 @@ extern bool g_use_posix_spawn;
 
 /// A variable entry. Stores the value of a variable and whether it should be exported.
 struct var_entry_t {
-    wcstring val;  // the value of the variable
+    // The elements of the variable. These are shared with the values returned by env_get_string,
+    // so they are copied before being modified unless this entry is the only owner.
+    shared_ptr<wcstring_list_t> vals;
     bool exportv;  // whether the variable should be exported
 
     var_entry_t() : exportv(false) {}
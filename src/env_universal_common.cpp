@@ -43,6 +43,11 @@
 #include <notify.h>
 #endif
 
+#if __linux__
+#define FISH_INOTIFY_AVAILABLE 1
+#include <sys/inotify.h>
+#endif
+
 // NAME_MAX is not defined on Solaris and suggests the use of pathconf()
 // There is no obvious sensible pathconf() for shared memory and _XPG_NAME_MAX
 // seems a reasonable choice.
@@ -62,6 +67,13 @@
 /// Non-wide version of the set_export command.
 #define SET_EXPORT_MBS "SET_EXPORT"
 
+/// Comment that identifies a rewritten fishd file. It is followed by the generation of the file.
+#define GENERATION_MBS "# Generation: "
+
+/// The fishd file is only rewritten once it has at least this many records, and more than half of
+/// them are overridden by later records.
+#define MIN_RECORDS_TO_COMPACT 64
+
 /// Error message.
 #define PARSE_ERR L"Unable to parse universal variable message: '%ls'"
 
@@ -156,12 +168,12 @@ static wcstring default_named_pipe_path() {
     return vars_filename_in_directory(get_runtime_path());
 }
 
-/// Test if the message msg contains the command cmd.
-static bool match(const wchar_t *msg, const wchar_t *cmd) {
-    size_t len = wcslen(cmd);
-    if (wcsncasecmp(msg, cmd, len) != 0) return false;
+/// Test if the message msg, of the given length, contains the command cmd.
+static bool match(const char *msg, size_t length, const char *cmd) {
+    size_t len = strlen(cmd);
+    if (length < len || strncasecmp(msg, cmd, len) != 0) return false;
 
-    if (msg[len] && msg[len] != L' ' && msg[len] != L'\t') return false;
+    if (length > len && msg[len] != ' ' && msg[len] != '\t') return false;
 
     return true;
 }
@@ -265,24 +277,30 @@ static bool append_file_entry(fish_message_type_t type, const wcstring &key_in,
 }
 
 env_universal_t::env_universal_t(const wcstring &path)
-    : explicit_vars_path(path), tried_renaming(false), last_read_file(kInvalidFileID) {
+    : explicit_vars_path(path),
+      tried_renaming(false),
+      last_read_file(kInvalidFileID),
+      last_read_offset(0),
+      log_records(0) {
     VOMIT_ON_FAILURE(pthread_mutex_init(&lock, NULL));
 }
 
 env_universal_t::~env_universal_t() { pthread_mutex_destroy(&lock); }
 
 env_var_t env_universal_t::get(const wcstring &name) const {
+    // Values may be decoded here, so take the lock.
+    scoped_lock locker(lock);
     env_var_t result = env_var_t::missing_var();
-    var_table_t::const_iterator where = vars.find(name);
+    uvar_table_t::const_iterator where = vars.find(name);
     if (where != vars.end()) {
-        result = env_var_t(where->second.val);
+        result = env_var_t(where->second.value());
     }
     return result;
 }
 
 bool env_universal_t::get_export(const wcstring &name) const {
     bool result = false;
-    var_table_t::const_iterator where = vars.find(name);
+    uvar_table_t::const_iterator where = vars.find(name);
     if (where != vars.end()) {
         result = where->second.exportv;
     }
@@ -297,9 +315,9 @@ void env_universal_t::set_internal(const wcstring &key, const wcstring &val, boo
         return;
     }
 
-    var_entry_t *entry = &vars[key];
-    if (entry->exportv != exportv || entry->val != val) {
-        entry->val = val;
+    uvar_entry_t *entry = &vars[key];
+    if (entry->exportv != exportv || entry->value() != val) {
+        entry->set_value(val);
         entry->exportv = exportv;
 
         // If we are overwriting, then this is now modified.
@@ -331,10 +349,10 @@ bool env_universal_t::remove(const wcstring &key) {
 wcstring_list_t env_universal_t::get_names(bool show_exported, bool show_unexported) const {
     wcstring_list_t result;
     scoped_lock locker(lock);
-    var_table_t::const_iterator iter;
+    uvar_table_t::const_iterator iter;
     for (iter = vars.begin(); iter != vars.end(); ++iter) {
         const wcstring &key = iter->first;
-        const var_entry_t &e = iter->second;
+        const uvar_entry_t &e = iter->second;
         if ((e.exportv && show_exported) || (!e.exportv && show_unexported)) {
             result.push_back(key);
         }
@@ -344,12 +362,12 @@ wcstring_list_t env_universal_t::get_names(bool show_exported, bool show_unexpor
 
 // Given a variable table, generate callbacks representing the difference between our vars and the
 // new vars.
-void env_universal_t::generate_callbacks(const var_table_t &new_vars,
+void env_universal_t::generate_callbacks(const uvar_table_t &new_vars,
                                          callback_data_list_t *callbacks) const {
     assert(callbacks != NULL);
 
     // Construct callbacks for erased values.
-    for (var_table_t::const_iterator iter = this->vars.begin(); iter != this->vars.end(); ++iter) {
+    for (uvar_table_t::const_iterator iter = this->vars.begin(); iter != this->vars.end(); ++iter) {
         const wcstring &key = iter->first;
 
         // Skip modified values.
@@ -364,7 +382,7 @@ void env_universal_t::generate_callbacks(const var_table_t &new_vars,
     }
 
     // Construct callbacks for newly inserted or changed values.
-    for (var_table_t::const_iterator iter = new_vars.begin(); iter != new_vars.end(); ++iter) {
+    for (uvar_table_t::const_iterator iter = new_vars.begin(); iter != new_vars.end(); ++iter) {
         const wcstring &key = iter->first;
 
         // Skip modified values.
@@ -373,33 +391,29 @@ void env_universal_t::generate_callbacks(const var_table_t &new_vars,
         }
 
         // See if the value has changed.
-        const var_entry_t &new_entry = iter->second;
-        var_table_t::const_iterator existing = this->vars.find(key);
+        const uvar_entry_t &new_entry = iter->second;
+        uvar_table_t::const_iterator existing = this->vars.find(key);
         if (existing == this->vars.end() || existing->second.exportv != new_entry.exportv ||
-            existing->second.val != new_entry.val) {
+            existing->second.value() != new_entry.value()) {
             // Value has changed.
             callbacks->push_back(
-                callback_data_t(new_entry.exportv ? SET_EXPORT : SET, key, new_entry.val));
+                callback_data_t(new_entry.exportv ? SET_EXPORT : SET, key, new_entry.value()));
         }
     }
 }
 
-void env_universal_t::acquire_variables(var_table_t *vars_to_acquire) {
+void env_universal_t::acquire_variables(uvar_table_t *vars_to_acquire) {
     // Copy modified values from existing vars to vars_to_acquire.
     for (std::set<wcstring>::iterator iter = this->modified.begin(); iter != this->modified.end();
          ++iter) {
         const wcstring &key = *iter;
-        var_table_t::iterator src_iter = this->vars.find(key);
+        uvar_table_t::iterator src_iter = this->vars.find(key);
         if (src_iter == this->vars.end()) {
             /* The value has been deleted. */
             vars_to_acquire->erase(key);
         } else {
-            // The value has been modified. Copy it over. Note we can destructively modify the
-            // source entry in vars since we are about to get rid of this->vars entirely.
-            var_entry_t &src = src_iter->second;
-            var_entry_t &dst = (*vars_to_acquire)[key];
-            dst.val.swap(src.val);
-            dst.exportv = src.exportv;
+            // The value has been modified. Copy it over.
+            (*vars_to_acquire)[key] = src_iter->second;
         }
     }
 
@@ -407,16 +421,91 @@ void env_universal_t::acquire_variables(var_table_t *vars_to_acquire) {
     this->vars.swap(*vars_to_acquire);
 }
 
-void env_universal_t::load_from_fd(int fd, callback_data_list_t *callbacks) {
+/// Reads the generation from the header of a rewritten fishd file, or returns an empty string if
+/// there is none.
+static std::string read_generation(int fd) {
+    char buffer[512];
+    ssize_t amt = pread(fd, buffer, sizeof buffer, 0);
+    if (amt <= 0) return std::string();
+
+    const std::string header(buffer, amt);
+    size_t start = header.find("\n" GENERATION_MBS);
+    if (start == std::string::npos) return std::string();
+    start += 1 + strlen(GENERATION_MBS);
+    size_t end = header.find('\n', start);
+    if (end == std::string::npos) return std::string();
+    return header.substr(start, end - start);
+}
+
+/// Returns whether the file we have open is the one we last read from, with records appended to it
+/// since, so that we only need to read the new records.
+bool env_universal_t::can_read_new_records(int fd, const file_id_t &current_file) const {
+    if (last_read_file == kInvalidFileID || last_read_generation.empty()) return false;
+    if (current_file.device != last_read_file.device || current_file.inode != last_read_file.inode)
+        return false;
+    if (current_file.size < (uint64_t)last_read_offset) return false;
+    return read_generation(fd) == last_read_generation;
+}
+
+/// Applies records appended to the file by other processes, announcing the variables that changed.
+void env_universal_t::apply_new_records(const callback_data_list_t &records,
+                                        callback_data_list_t *callbacks) {
+    ASSERT_IS_LOCKED(lock);
+    // Only the last record for each variable matters.
+    std::map<wcstring, const callback_data_t *> latest;
+    for (size_t i = 0; i < records.size(); i++) {
+        latest[records.at(i).key] = &records.at(i);
+    }
+
+    std::map<wcstring, const callback_data_t *>::const_iterator iter;
+    for (iter = latest.begin(); iter != latest.end(); ++iter) {
+        const wcstring &key = iter->first;
+        const callback_data_t &record = *iter->second;
+
+        // Skip modified values, as when reading the whole file.
+        if (this->modified.find(key) != this->modified.end()) {
+            continue;
+        }
+
+        uvar_table_t::iterator existing = this->vars.find(key);
+        const bool exportv = record.type == SET_EXPORT;
+        if (existing == this->vars.end() || existing->second.exportv != exportv ||
+            existing->second.value() != record.val) {
+            uvar_entry_t &entry = this->vars[key];
+            entry.set_value(record.val);
+            entry.exportv = exportv;
+            if (callbacks != NULL) callbacks->push_back(record);
+        }
+    }
+}
+
+void env_universal_t::load_from_fd(int fd, const wcstring &path,
+                                   callback_data_list_t *callbacks) {
     ASSERT_IS_LOCKED(lock);
     assert(fd >= 0);
     // Get the dev / inode.
     const file_id_t current_file = file_id_for_fd(fd);
     if (current_file == last_read_file) {
         debug(5, L"universal log sync elided based on fstat()");
+    } else if (this->can_read_new_records(fd, current_file)) {
+        // Other processes have appended records. Read only those.
+        debug(5, L"universal log reading new records");
+        callback_data_list_t records;
+        size_t record_count = 0;
+        const uvar_file_contents_t contents(fd, path, last_read_offset);
+        last_read_offset +=
+            this->read_message_internal(contents, NULL, &records, NULL, &record_count);
+        this->apply_new_records(records, callbacks);
+        log_records += record_count;
+        last_read_file = current_file;
     } else {
-        // Read a variables table from the file.
-        var_table_t new_vars = this->read_message_internal(fd);
+        // Read a variables table from the file. The values are decoded when they are used.
+        uvar_table_t new_vars;
+        std::string generation;
+        size_t record_count = 0;
+        const uvar_file_contents_t contents(fd, path, 0);
+        off_t end =
+            this->read_message_internal(contents, &new_vars, NULL, &generation, &record_count);
 
         // Announce changes.
         if (callbacks != NULL) {
@@ -426,6 +515,9 @@ void env_universal_t::load_from_fd(int fd, callback_data_list_t *callbacks) {
         // Acquire the new variables.
         this->acquire_variables(&new_vars);
         last_read_file = current_file;
+        last_read_offset = end;
+        last_read_generation = generation;
+        log_records = record_count;
     }
 }
 
@@ -443,7 +535,7 @@ bool env_universal_t::load_from_path(const wcstring &path, callback_data_list_t
     int fd = wopen_cloexec(path, O_RDONLY);
     if (fd >= 0) {
         debug(5, L"universal log reading from file");
-        this->load_from_fd(fd, callbacks);
+        this->load_from_fd(fd, path, callbacks);
         close(fd);
         result = true;
     }
@@ -462,16 +554,25 @@ bool env_universal_t::write_to_fd(int fd, const wcstring &path) {
     // Temporary storage.
     std::string storage;
 
-    // Write the save message. If this fails, we don't bother complaining.
-    write_loop(fd, SAVE_MSG, strlen(SAVE_MSG));
-
-    var_table_t::const_iterator iter = vars.begin();
+    // Write the save message, with a new generation so that other processes notice this file
+    // replaced the one they read even if it has the same inode. If this fails, we don't bother
+    // complaining.
+    struct timeval now = {};
+    gettimeofday(&now, NULL);
+    char generation[64];
+    snprintf(generation, sizeof generation, "%ld.%ld.%ld", (long)getpid(), (long)now.tv_sec,
+             (long)now.tv_usec);
+    const std::string header = std::string(SAVE_MSG) + GENERATION_MBS + generation + "\n";
+    write_loop(fd, header.data(), header.size());
+
+    uvar_table_t::const_iterator iter = vars.begin();
     while (iter != vars.end()) {
         // Append the entry. Note that append_file_entry may fail, but that only affects one
         // variable; soldier on.
         const wcstring &key = iter->first;
-        const var_entry_t &entry = iter->second;
-        append_file_entry(entry.exportv ? SET_EXPORT : SET, key, entry.val, &contents, &storage);
+        const uvar_entry_t &entry = iter->second;
+        append_file_entry(entry.exportv ? SET_EXPORT : SET, key, entry.value(), &contents,
+                          &storage);
 
         // Go to next.
         ++iter;
@@ -491,11 +592,63 @@ bool env_universal_t::write_to_fd(int fd, const wcstring &path) {
 
     // Since we just wrote out this file, it matches our internal state; pretend we read from it.
     this->last_read_file = file_id_for_fd(fd);
+    this->last_read_offset = lseek(fd, 0, SEEK_CUR);
+    this->last_read_generation = generation;
+    this->log_records = vars.size();
 
     // We don't close the file.
     return success;
 }
 
+/// Appends records for our modified variables to the fd, which must be locked and have been read
+/// up to its end. path is provided only for error reporting.
+bool env_universal_t::append_to_fd(int fd, const wcstring &path) {
+    ASSERT_IS_LOCKED(lock);
+    assert(fd >= 0);
+    std::string contents;
+    std::string storage;
+    size_t records = 0;
+    for (std::set<wcstring>::const_iterator iter = modified.begin(); iter != modified.end();
+         ++iter) {
+        const wcstring &key = *iter;
+        uvar_table_t::const_iterator where = vars.find(key);
+        assert(where != vars.end());  // erasing a variable compacts the file instead
+        const uvar_entry_t &entry = where->second;
+        if (append_file_entry(entry.exportv ? SET_EXPORT : SET, key, entry.value(), &contents,
+                              &storage)) {
+            records++;
+        }
+    }
+
+    off_t end = lseek(fd, 0, SEEK_END);
+    if (end < 0 || write_loop(fd, contents.data(), contents.size()) < 0) {
+        int err = errno;
+        report_error(err, L"Unable to write to universal variables file '%ls'", path.c_str());
+        return false;
+    }
+
+    // Nobody else can write while we hold the lock, so we have read everything up to the records
+    // we just wrote.
+    this->last_read_file = file_id_for_fd(fd);
+    this->last_read_offset = end + (off_t)contents.size();
+    this->log_records += records;
+    return true;
+}
+
+/// Returns whether the file should be rewritten instead of appended to, because it was written by
+/// an older version of fish, a variable was erased, or most of its records are overridden by later
+/// ones.
+bool env_universal_t::needs_compaction() const {
+    if (last_read_generation.empty()) return true;
+    // The log has no records for erasing variables, since older versions of fish would skip them
+    // and bring the variables back the next time they rewrite the file.
+    for (std::set<wcstring>::const_iterator iter = modified.begin(); iter != modified.end();
+         ++iter) {
+        if (vars.find(*iter) == vars.end()) return true;
+    }
+    return log_records >= MIN_RECORDS_TO_COMPACT && log_records > 2 * vars.size();
+}
+
 bool env_universal_t::move_new_vars_file_into_place(const wcstring &src, const wcstring &dst) {
     int ret = wrename(src, dst);
     if (ret != 0) {
@@ -540,10 +693,11 @@ static wcstring fishd_get_config() {
 
 bool env_universal_t::load() {
     scoped_lock locker(lock);
-    callback_data_list_t callbacks;
     const wcstring vars_path =
         explicit_vars_path.empty() ? default_vars_path() : explicit_vars_path;
-    bool success = load_from_path(vars_path, &callbacks);
+    // Nobody is told about the variables we load, so don't generate callbacks. That would decode
+    // every value.
+    bool success = load_from_path(vars_path, NULL);
     if (!success && !tried_renaming && errno == ENOENT) {
         // We failed to load, because the file was not found. Older fish used the hostname only. Try
         // moving the filename based on the hostname into place; if that succeeds try again.
@@ -674,26 +828,40 @@ bool env_universal_t::open_and_acquire_lock(const wcstring &path, int *out_fd) {
 bool env_universal_t::sync(callback_data_list_t *callbacks) {
     debug(5, L"universal log sync");
     scoped_lock locker(lock);
-    // Our saving strategy:
+    // The file is a log of records that set variables, where later records override earlier ones.
+    // Older versions of fish read it the same way, and ignore the generation comment, so they can
+    // share the file with us. They rewrite it whenever they save, which we notice like any other
+    // rewrite. There are no records for erasing variables, since older versions would skip them;
+    // erasing a variable compacts the file instead. Our saving strategy:
     //
     // 1. Open the file, producing an fd.
     // 2. Lock the file (may be combined with step 1 on systems with O_EXLOCK)
     // 3. After taking the lock, check if the file at the given path is different from what we
     // opened. If so, start over.
-    // 4. Read from the file. This can be elided if its dev/inode is unchanged since the last read
-    // 5. Open an adjacent temporary file
-    // 6. Write our changes to an adjacent file
-    // 7. Move the adjacent file into place via rename. This is assumed to be atomic.
-    // 8. Release the lock and close the file
+    // 4. Read from the file. This can be elided if its dev/inode is unchanged since the last read,
+    // and only the records appended since the last read are read if it is the same file.
+    // 5. Append records for our changes to the file.
+    // 6. Release the lock and close the file
+    //
+    // Once most records in the file are overridden by later ones, or a variable was erased, we
+    // compact it instead of step 5:
+    //
+    // 5a. Open an adjacent temporary file
+    // 5b. Write all variables to the adjacent file
+    // 5c. Move the adjacent file into place via rename. This is assumed to be atomic.
     //
     // Consider what happens if Process 1 and 2 both do this simultaneously. Can there be data loss?
     // Process 1 opens the file and then attempts to take the lock. Now, either process 1 will see
     // the original file, or process 2's new file. If it sees the new file, we're OK: it's going to
     // read from the new file, and so there's no data loss. If it sees the old file, then process 2
     // must have locked it (if process 1 locks it, switch their roles). The lock will block until
-    // process 2 reaches step 7; at that point process 1 will reach step 2, notice that the file has
+    // process 2 reaches step 6. If process 2 appended to the file, process 1 reads its records in
+    // step 4. If it compacted the file, process 1 will reach step 2, notice that the file has
     // changed, and then start over.
     //
+    // Processes that only read the file don't take the lock, and may see a record that is still
+    // being appended. Reading stops at the last complete record, and the rest is read next time.
+    //
     // It's possible that the underlying filesystem does not support locks (lockless NFS). In this
     // case, we risk data loss if two shells try to write their universal variables simultaneously.
     // In practice this is unlikely, since uvars are usually written interactively.
@@ -724,7 +892,7 @@ bool env_universal_t::sync(callback_data_list_t *callbacks) {
     int private_fd = -1;
     wcstring private_file_path;
 
-    debug(5, L"universal log performing full sync");
+    debug(5, L"universal log writing modifications");
 
     // Open the file.
     if (success) {
@@ -735,23 +903,31 @@ bool env_universal_t::sync(callback_data_list_t *callbacks) {
     // Read from it.
     if (success) {
         assert(vars_fd >= 0);
-        this->load_from_fd(vars_fd, callbacks);
+        this->load_from_fd(vars_fd, vars_path, callbacks);
+    }
+
+    // Append our changes, unless the file needs to be compacted.
+    const bool compact = success && this->needs_compaction();
+    if (success && !compact) {
+        success = this->append_to_fd(vars_fd, vars_path);
+        if (!success) debug(5, L"universal log append_to_fd() failed");
     }
 
     // Open adjacent temporary file.
-    if (success) {
+    if (compact) {
+        debug(5, L"universal log compacting");
         success = this->open_temporary_file(directory, &private_file_path, &private_fd);
         if (!success) debug(5, L"universal log open_temporary_file() failed");
     }
 
     // Write to it.
-    if (success) {
+    if (compact && success) {
         assert(private_fd >= 0);
         success = this->write_to_fd(private_fd, private_file_path);
         if (!success) debug(5, L"universal log write_to_fd() failed");
     }
 
-    if (success) {
+    if (compact && success) {
         // Ensure we maintain ownership and permissions (#2176).
         struct stat sbuf;
         if (wstat(vars_path, &sbuf) >= 0) {
@@ -781,7 +957,7 @@ bool env_universal_t::sync(callback_data_list_t *callbacks) {
         if (!success) debug(5, L"universal log move_new_vars_file_into_place() failed");
     }
 
-    if (success) {
+    if (compact && success) {
         // Since we moved the new file into place, clear the path so we don't try to unlink it.
         private_file_path.clear();
     }
@@ -805,89 +981,142 @@ bool env_universal_t::sync(callback_data_list_t *callbacks) {
     return success;
 }
 
-var_table_t env_universal_t::read_message_internal(int fd) {
-    var_table_t result;
+uvar_file_contents_t::uvar_file_contents_t(int fd, const wcstring &path, off_t offset)
+    : data(NULL), length(0), mapped(false) {
+    // Map the whole file. It is only used while the records are parsed, and values are copied out
+    // of it, so nothing depends on the file once that is done. The mapping outlives fd, and would
+    // keep any flock() on fd held, so map a separate open of the same file.
+    struct stat buf, map_buf;
+    int map_fd = offset == 0 ? wopen_cloexec(path, O_RDONLY) : -1;
+    if (map_fd >= 0) {
+        if (fstat(fd, &buf) == 0 && fstat(map_fd, &map_buf) == 0 &&
+            buf.st_dev == map_buf.st_dev && buf.st_ino == map_buf.st_ino && buf.st_size > 0) {
+            void *addr = mmap(NULL, (size_t)buf.st_size, PROT_READ, MAP_PRIVATE, map_fd, 0);
+            if (addr != MAP_FAILED) {
+                data = (const char *)addr;
+                length = (size_t)buf.st_size;
+                mapped = true;
+            }
+        }
+        close(map_fd);
+        if (mapped) return;
+    }
+
+    // Read it instead.
+    if (lseek(fd, offset, SEEK_SET) < 0) return;
+    char chunk[4096];
+    ssize_t amt;
+    while ((amt = read_loop(fd, chunk, sizeof chunk)) > 0) {
+        buffer.append(chunk, amt);
+    }
+    data = buffer.data();
+    length = buffer.size();
+}
+
+uvar_file_contents_t::~uvar_file_contents_t() {
+    if (mapped) munmap((void *)data, length);
+}
+
+/// Decodes a value as stored in the file.
+static wcstring decode_value(const char *data, size_t length) {
+    wcstring wide, result;
+    if (utf8_to_wchar(data, length, &wide, 0)) {
+        unescape_string(wide, &result, 0);
+    }
+    return result;
+}
 
-    // Temp value used to avoid repeated allocations.
-    wcstring storage;
+const wcstring &uvar_entry_t::value() const {
+    if (is_encoded) {
+        val = decode_value(encoded.data(), encoded.size());
+        std::string().swap(encoded);
+        is_encoded = false;
+    }
+    return val;
+}
 
-    // The line we construct (and then parse).
-    std::string line;
-    wcstring wide_line;
+/// Reads the records in the contents, and the generation if there is one. If vars is given, records
+/// are applied to it, leaving values to be decoded when they are used. If records is given, they
+/// are added to it with their values decoded. Returns the offset in the contents after the last
+/// complete record.
+size_t env_universal_t::read_message_internal(const uvar_file_contents_t &contents,
+                                              uvar_table_t *vars, callback_data_list_t *records,
+                                              std::string *generation, size_t *record_count) {
+    const char *data = contents.begin();
+    const size_t length = contents.size();
+    size_t line_start = 0;
     for (;;) {
-        // Read into a buffer. Note this is NOT null-terminated!
-        char buffer[1024];
-        ssize_t amt = read_loop(fd, buffer, sizeof buffer);
-        if (amt <= 0) {
+        const char *newline = (const char *)memchr(data + line_start, '\n', length - line_start);
+        if (newline == NULL) {
+            // An unterminated last line may still be being written. It is read once it is
+            // complete.
             break;
         }
-        const size_t bufflen = (size_t)amt;
-
-        // Walk over it by lines. The contents of an unterminated line will be left in 'line' for
-        // the next iteration.
-        ssize_t line_start = 0;
-        while (line_start < amt) {
-            // Run until we hit a newline.
-            size_t cursor = line_start;
-            while (cursor < bufflen && buffer[cursor] != '\n') {
-                cursor++;
+        const size_t line_end = newline - data;
+        const size_t line_length = line_end - line_start;
+        const char *line = data + line_start;
+        if (line_length > strlen(GENERATION_MBS) &&
+            strncmp(line, GENERATION_MBS, strlen(GENERATION_MBS)) == 0) {
+            if (generation != NULL) {
+                generation->assign(line + strlen(GENERATION_MBS),
+                                   line_length - strlen(GENERATION_MBS));
             }
-
-            // Copy over what we read.
-            line.append(buffer + line_start, cursor - line_start);
-
-            // Process it if it's a newline (which is true if we are before the end of the buffer).
-            if (cursor < bufflen && !line.empty()) {
-                if (utf8_to_wchar(line.data(), line.size(), &wide_line, 0)) {
-                    env_universal_t::parse_message_internal(wide_line, &result, &storage);
-                }
-                line.clear();
+        } else if (line_length > 0 && line[0] != '#') {
+            if (parse_message_internal(contents, line_start, line_end, vars, records)) {
+                ++*record_count;
             }
-
-            // Skip over the newline (or skip past the end).
-            line_start = cursor + 1;
         }
+        line_start = line_end + 1;
     }
-
-    // We make no effort to handle an unterminated last line.
-    return result;
+    return line_start;
 }
 
-/// Parse message msg/
-void env_universal_t::parse_message_internal(const wcstring &msgstr, var_table_t *vars,
-                                             wcstring *storage) {
-    const wchar_t *msg = msgstr.c_str();
-
-    // debug(3, L"parse_message( %ls );", msg);
-    if (msg[0] == L'#') return;
-
-    bool is_set_export = match(msg, SET_EXPORT_STR);
-    bool is_set = !is_set_export && match(msg, SET_STR);
-    if (is_set || is_set_export) {
-        const wchar_t *name, *tmp;
-        const bool exportv = is_set_export;
-
-        name = msg + (exportv ? wcslen(SET_EXPORT_STR) : wcslen(SET_STR));
-        while (name[0] == L'\t' || name[0] == L' ') name++;
-
-        tmp = wcschr(name, L':');
-        if (tmp) {
-            // Use 'storage' to hold our key to avoid allocations.
-            storage->assign(name, tmp - name);
-            const wcstring &key = *storage;
-
-            wcstring val;
-            if (unescape_string(tmp + 1, &val, 0)) {
-                var_entry_t &entry = (*vars)[key];
-                entry.exportv = exportv;
-                entry.val.swap(val);  // acquire the value
-            }
-        } else {
-            debug(1, PARSE_ERR, msg);
-        }
+/// Parses the record between the start and end offsets of the contents, applying it to vars or
+/// adding it to records. Returns whether it was a valid record.
+bool env_universal_t::parse_message_internal(const uvar_file_contents_t &contents, size_t start,
+                                             size_t end, uvar_table_t *vars,
+                                             callback_data_list_t *records) {
+    const char *msg = contents.begin() + start;
+    const size_t msg_length = end - start;
+
+    fish_message_type_t type;
+    size_t cursor;
+    if (match(msg, msg_length, SET_EXPORT_MBS)) {
+        type = SET_EXPORT;
+        cursor = strlen(SET_EXPORT_MBS);
+    } else if (match(msg, msg_length, SET_MBS)) {
+        type = SET;
+        cursor = strlen(SET_MBS);
     } else {
-        debug(1, PARSE_ERR, msg);
+        debug(1, PARSE_ERR, str2wcstring(msg, msg_length).c_str());
+        return false;
+    }
+    while (cursor < msg_length && (msg[cursor] == ' ' || msg[cursor] == '\t')) cursor++;
+
+    // The name runs up to the ':' before the value.
+    const char *colon = (const char *)memchr(msg + cursor, ':', msg_length - cursor);
+    if (colon == NULL) {
+        debug(1, PARSE_ERR, str2wcstring(msg, msg_length).c_str());
+        return false;
+    }
+    const size_t name_end = colon - msg;
+    wcstring key;
+    if (!utf8_to_wchar(msg + cursor, name_end - cursor, &key, 0)) {
+        return false;
     }
+
+    const size_t val_start = name_end + 1;
+    if (vars != NULL) {
+        uvar_entry_t &entry = (*vars)[key];
+        entry.exportv = type == SET_EXPORT;
+        entry.set_encoded_value(msg + val_start, msg_length - val_start);
+    }
+    if (records != NULL) {
+        wcstring val = decode_value(msg + val_start, msg_length - val_start);
+        records->push_back(callback_data_t(type, key, L""));
+        records->back().val.swap(val);  // acquire the value
+    }
+    return true;
 }
 
 /// Maximum length of hostname. Longer hostnames are truncated.
@@ -1394,6 +1623,104 @@ class universal_notifier_named_pipe_t : public universal_notifier_t {
     }
 };
 
+/// An inotify-based notifier. Writing the variables file is itself the notification: we watch the
+/// directory containing the file, and report the events that concern the file. Those are appending
+/// to it, and moving a compacted file into place. Watching the directory instead of the file keeps
+/// working when the file is replaced.
+///
+/// Shells using the named pipe, like older versions of fish, don't watch the file, so we post
+/// notifications to the pipe as well.
+class universal_notifier_inotify_t : public universal_notifier_t {
+    int inotify_fd;
+    universal_notifier_named_pipe_t pipe_notifier;
+    // Name of the variables file within the watched directory.
+    std::string file_name;
+
+    void setup_inotify(const wchar_t *test_path) {
+#if FISH_INOTIFY_AVAILABLE
+        const wcstring vars_path = test_path ? wcstring(test_path) : default_vars_path();
+        if (vars_path.empty()) return;
+        file_name = wcs2string(wbasename(vars_path));
+
+        int fd = inotify_init();
+        if (fd < 0) {
+            report_error(errno, L"Unable to initialize inotify for universal variables");
+            return;
+        }
+        set_cloexec(fd);
+        int flags = fcntl(fd, F_GETFL, 0);
+        if (flags >= 0) fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+        const std::string directory = wcs2string(wdirname(vars_path));
+        const uint32_t mask = IN_MODIFY | IN_CREATE | IN_MOVED_TO | IN_DELETE;
+        if (inotify_add_watch(fd, directory.c_str(), mask) < 0) {
+            debug(2, L"Unable to watch '%s' for universal variable changes", directory.c_str());
+            close(fd);
+            return;
+        }
+        inotify_fd = fd;
+#else
+        UNUSED(test_path);
+#endif
+    }
+
+   public:
+    explicit universal_notifier_inotify_t(const wchar_t *test_path)
+        : inotify_fd(-1), pipe_notifier(test_path) {
+        setup_inotify(test_path);
+    }
+
+    ~universal_notifier_inotify_t() {
+        if (inotify_fd >= 0) {
+            close(inotify_fd);
+        }
+    }
+
+    /// Returns whether the variables file is being watched.
+    bool is_watching() const { return inotify_fd >= 0; }
+
+    int notification_fd() { return inotify_fd; }
+
+    bool notification_fd_became_readable(int fd) {
+        // Read all pending events, and report whether any of them concerns the variables file, so
+        // that changes to other files in the directory don't cause a sync.
+        assert(fd == inotify_fd);
+        bool changed = false;
+#if FISH_INOTIFY_AVAILABLE
+        // Events are read whole, and must be suitably aligned.
+        uint32_t buff[1024];
+        ssize_t amt_read;
+        while ((amt_read = read(inotify_fd, buff, sizeof buff)) > 0) {
+            const char *cursor = (const char *)buff;
+            const char *end = cursor + amt_read;
+            while (cursor < end) {
+                const struct inotify_event *event = (const struct inotify_event *)cursor;
+                if (event->mask & IN_Q_OVERFLOW) {
+                    changed = true;  // we lost events, so we must assume the file changed
+                } else if (event->len > 0 && file_name == event->name) {
+                    changed = true;
+                }
+                cursor += sizeof(struct inotify_event) + event->len;
+            }
+        }
+#endif
+        return changed;
+    }
+
+    void post_notification() { pipe_notifier.post_notification(); }
+
+    // We need to be polled to read back what we wrote to the pipe, but never notice changes that
+    // way.
+    unsigned long usec_delay_between_polls() const {
+        return pipe_notifier.usec_delay_between_polls();
+    }
+
+    bool poll() {
+        pipe_notifier.poll();
+        return false;
+    }
+};
+
 class universal_notifier_null_t : public universal_notifier_t {};  // does nothing
 
 static universal_notifier_t::notifier_strategy_t fetch_default_strategy_from_environment() {
@@ -1405,7 +1732,8 @@ static universal_notifier_t::notifier_strategy_t fetch_default_strategy_from_env
     } options[] = {{"default", universal_notifier_t::strategy_default},
                    {"shmem", universal_notifier_t::strategy_shmem_polling},
                    {"pipe", universal_notifier_t::strategy_named_pipe},
-                   {"notifyd", universal_notifier_t::strategy_notifyd}};
+                   {"notifyd", universal_notifier_t::strategy_notifyd},
+                   {"inotify", universal_notifier_t::strategy_inotify}};
     const size_t opt_count = sizeof options / sizeof *options;
 
     const char *var = getenv(UNIVERSAL_NOTIFIER_ENV_NAME);
@@ -1440,6 +1768,8 @@ universal_notifier_t::notifier_strategy_t universal_notifier_t::resolve_default_
     }
 #if FISH_NOTIFYD_AVAILABLE
     return strategy_notifyd;
+#elif FISH_INOTIFY_AVAILABLE
+    return strategy_inotify;
 #elif defined(__CYGWIN__)
     return strategy_shmem_polling;
 #else
@@ -1464,6 +1794,13 @@ universal_notifier_t *universal_notifier_t::new_notifier_for_strategy(
         case strategy_notifyd: {
             return new universal_notifier_notifyd_t();
         }
+        case strategy_inotify: {
+            universal_notifier_inotify_t *result = new universal_notifier_inotify_t(test_path);
+            if (result->is_watching()) return result;
+            // Fall back to the named pipe, e.g. if we are out of inotify watches.
+            delete result;
+            return new universal_notifier_named_pipe_t(test_path);
+        }
         case strategy_named_pipe: {
             return new universal_notifier_named_pipe_t(test_path);
         }
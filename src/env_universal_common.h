@@ -3,6 +3,7 @@
 
 #include <pthread.h>
 #include <stdio.h>
+#include <sys/types.h>
 #include <memory>
 #include <set>
 #include <vector>
@@ -11,7 +12,7 @@
 #include "env.h"
 #include "wutil.h"
 
-/// The different types of messages found in the fishd file.
+/// The different types of records found in the fishd file.
 typedef enum { SET, SET_EXPORT, ERASE } fish_message_type_t;
 
 /// Callback data, reflecting a change in universal variables.
@@ -26,9 +27,66 @@ struct callback_data_t {
 
 typedef std::vector<struct callback_data_t> callback_data_list_t;
 
+/// The contents of a variables file, mapped into memory if possible, while its records are parsed.
+class uvar_file_contents_t {
+    const char *data;
+    size_t length;
+    bool mapped;
+    std::string buffer;
+
+    // No copying.
+    uvar_file_contents_t &operator=(const uvar_file_contents_t &);
+    uvar_file_contents_t(const uvar_file_contents_t &);
+
+   public:
+    /// Maps or reads the contents of the file open as fd, from the given offset to its end. path is
+    /// the path of the file, which is opened again to be mapped.
+    uvar_file_contents_t(int fd, const wcstring &path, off_t offset);
+    ~uvar_file_contents_t();
+
+    const char *begin() const { return data; }
+    size_t size() const { return length; }
+};
+
+/// A universal variable. Universal variables are kept as they are stored in the file, with the
+/// elements joined with ARRAY_SEP. Values read from the file are only decoded when they are first
+/// used, since most universal variables are never used by a given shell.
+struct uvar_entry_t {
+   private:
+    // The decoded value, if is_encoded is false.
+    mutable wcstring val;
+    // The value as stored in the file, until it is decoded.
+    mutable std::string encoded;
+    mutable bool is_encoded;
+
+   public:
+    bool exportv;  // whether the variable should be exported
+
+    uvar_entry_t() : val(), encoded(), is_encoded(false), exportv(false) {}
+
+    /// Returns the value, decoding it if necessary.
+    const wcstring &value() const;
+
+    void set_value(const wcstring &v) {
+        val = v;
+        encoded.clear();
+        is_encoded = false;
+    }
+
+    /// Sets the value to the given one as stored in the file. It is copied, so that the entry
+    /// doesn't depend on the file staying the same.
+    void set_encoded_value(const char *data, size_t length) {
+        val.clear();
+        encoded.assign(data, length);
+        is_encoded = true;
+    }
+};
+
+typedef std::map<wcstring, uvar_entry_t> uvar_table_t;
+
 /// Class representing universal variables.
 class env_universal_t {
-    var_table_t vars;  // current values
+    uvar_table_t vars;  // current values
 
     // Keys that have been modified, and need to be written. A value here that is not present in
     // vars indicates a deleted value.
@@ -40,7 +98,9 @@ class env_universal_t {
     mutable pthread_mutex_t lock;
     bool tried_renaming;
     bool load_from_path(const wcstring &path, callback_data_list_t *callbacks);
-    void load_from_fd(int fd, callback_data_list_t *callbacks);
+    void load_from_fd(int fd, const wcstring &path, callback_data_list_t *callbacks);
+    bool can_read_new_records(int fd, const file_id_t &current_file) const;
+    void apply_new_records(const callback_data_list_t &records, callback_data_list_t *callbacks);
 
     void set_internal(const wcstring &key, const wcstring &val, bool exportv, bool overwrite);
     bool remove_internal(const wcstring &name);
@@ -49,21 +109,39 @@ class env_universal_t {
     bool open_and_acquire_lock(const wcstring &path, int *out_fd);
     bool open_temporary_file(const wcstring &directory, wcstring *out_path, int *out_fd);
     bool write_to_fd(int fd, const wcstring &path);
+    bool append_to_fd(int fd, const wcstring &path);
     bool move_new_vars_file_into_place(const wcstring &src, const wcstring &dst);
+    bool needs_compaction() const;
 
     // File id from which we last read.
     file_id_t last_read_file;
 
+    // Offset in that file up to which we have read records. Records that other processes append
+    // after it are read and applied on the next sync.
+    off_t last_read_offset;
+
+    // Generation written at the top of the file when it was last rewritten, which tells a rewritten
+    // file apart from the one we read even if it reuses its inode. Empty for files written by older
+    // versions of fish.
+    std::string last_read_generation;
+
+    // Number of records in the file, including those overridden by later ones.
+    size_t log_records;
+
     // Given a variable table, generate callbacks representing the difference between our vars and
     // the new vars.
-    void generate_callbacks(const var_table_t &new_vars, callback_data_list_t *callbacks) const;
+    void generate_callbacks(const uvar_table_t &new_vars, callback_data_list_t *callbacks) const;
 
     // Given a variable table, copy unmodified values into self. May destructively modified
     // vars_to_acquire.
-    void acquire_variables(var_table_t *vars_to_acquire);
+    void acquire_variables(uvar_table_t *vars_to_acquire);
 
-    static void parse_message_internal(const wcstring &msg, var_table_t *vars, wcstring *storage);
-    static var_table_t read_message_internal(int fd);
+    static bool parse_message_internal(const uvar_file_contents_t &contents, size_t start,
+                                       size_t end, uvar_table_t *vars,
+                                       callback_data_list_t *records);
+    static size_t read_message_internal(const uvar_file_contents_t &contents, uvar_table_t *vars,
+                                        callback_data_list_t *records, std::string *generation,
+                                        size_t *record_count);
 
    public:
     explicit env_universal_t(const wcstring &path);
@@ -126,6 +204,10 @@ class universal_notifier_t {
         // Strategy that uses notify(3). Simple and efficient, but OS X only.
         strategy_notifyd,
 
+        // Strategy that uses inotify(7) to watch the variables file. Simple and efficient, but Linux
+        // only.
+        strategy_inotify,
+
         // Null notifier, does nothing.
         strategy_null
     };
@@ -10,6 +10,7 @@
 #include <signal.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <wchar.h>
 #include <algorithm>
@@ -32,12 +33,14 @@
 #include "fallback.h"  // IWYU pragma: keep
 #include "function.h"
 #include "io.h"
+#include "iothread.h"
 #include "parse_tree.h"
 #include "parser.h"
 #include "postfork.h"
 #include "proc.h"
 #include "reader.h"
 #include "signal.h"
+#include "util.h"
 #include "wutil.h"  // IWYU pragma: keep
 
 /// File descriptor redirection error message.
@@ -114,18 +117,6 @@ static bool redirection_is_to_real_file(const io_data_t *io) {
     return result;
 }
 
-static bool chain_contains_redirection_to_real_file(const io_chain_t &io_chain) {
-    bool result = false;
-    for (size_t idx = 0; idx < io_chain.size(); idx++) {
-        const io_data_t *io = io_chain.at(idx).get();
-        if (redirection_is_to_real_file(io)) {
-            result = true;
-            break;
-        }
-    }
-    return result;
-}
-
 /// Returns the interpreter for the specified script. Returns NULL if file is not a script with a
 /// shebang.
 char *get_interpreter(const char *command, char *interpreter, size_t buff_size) {
@@ -309,10 +300,11 @@ static bool io_transmogrify(const io_chain_t &in_chain, io_chain_t *out_chain,
 /// \param node_offset the offset of the node to evalute, or NODE_OFFSET_INVALID
 /// \param block_type the type of block to push on evaluation
 /// \param ios the io redirections to be performed on this block
-static void internal_exec_helper(parser_t &parser, const wcstring &def, node_offset_t node_offset,
+static void internal_exec_helper(parser_t &parser, const wcstring &def,
+                                 const parsed_tree_ref_t &def_tree, node_offset_t node_offset,
                                  enum block_type_t block_type, const io_chain_t &ios) {
     // If we have a valid node offset, then we must not have a string to execute.
-    assert(node_offset == NODE_OFFSET_INVALID || def.empty());
+    assert(node_offset == NODE_OFFSET_INVALID || (def.empty() && !def_tree));
 
     io_chain_t morphed_chain;
     std::vector<int> opened_fds;
@@ -326,7 +318,9 @@ static void internal_exec_helper(parser_t &parser, const wcstring &def, node_off
 
     signal_unblock();
 
-    if (node_offset == NODE_OFFSET_INVALID) {
+    if (def_tree) {
+        parser.eval_parsed_tree(def, morphed_chain, block_type, def_tree);
+    } else if (node_offset == NODE_OFFSET_INVALID) {
         parser.eval(def, morphed_chain, block_type);
     } else {
         parser.eval_block_node(node_offset, morphed_chain, block_type);
@@ -339,34 +333,330 @@ static void internal_exec_helper(parser_t &parser, const wcstring &def, node_off
     job_reap(0);
 }
 
-// Returns whether we can use posix spawn for a given process in a given job. Per
-// https://github.com/fish-shell/fish-shell/issues/364 , error handling for file redirections is too
-// difficult with posix_spawn, so in that case we use fork/exec.
-//
-// Furthermore, to avoid the race between the caller calling tcsetpgrp() and the client checking the
-// foreground process group, we don't use posix_spawn if we're going to foreground the process. (If
-// we use fork(), we can call tcsetpgrp after the fork, before the exec, and avoid the race).
-static bool can_use_posix_spawn_for_job(const job_t *job, const process_t *process) {
-    if (job_get_flag(job, JOB_CONTROL)) {  //!OCLINT(collapsible if statements)
-        // We are going to use job control; therefore when we launch this job it will get its own
-        // process group ID. But will it be foregrounded?
-        if (job_get_flag(job, JOB_TERMINAL) && job_get_flag(job, JOB_FOREGROUND)) {
-            // It will be foregrounded, so we will call tcsetpgrp(), therefore do not use
-            // posix_spawn.
-            return false;
+/// Runs a function or block process in the shell itself, with the given IO chain.
+static void exec_internal_process(parser_t &parser, process_t *p, const io_chain_t &io_chain) {
+    if (p->type == INTERNAL_BLOCK_NODE) {
+        internal_exec_helper(parser, wcstring(), parsed_tree_ref_t(), p->internal_block_node, TOP,
+                             io_chain);
+        return;
+    }
+    assert(p->type == INTERNAL_FUNCTION);
+
+    // Calls to function_get_definition might need to source a file as a part of autoloading, hence
+    // there must be no blocks.
+    signal_unblock();
+    const wcstring func_name = p->argv0();
+    wcstring def;
+    parsed_tree_ref_t def_tree;
+    bool function_exists = function_get_parsed_definition(func_name, &def, &def_tree);
+    bool shadow_scope = function_get_shadow_scope(func_name);
+    const std::map<wcstring, env_var_t> inherit_vars = function_get_inherit_vars(func_name);
+
+    signal_block();
+
+    if (!function_exists) {
+        debug(0, _(L"Unknown function '%ls'"), p->argv0());
+        return;
+    }
+    function_block_t *newv = new function_block_t(p, func_name, shadow_scope);
+    parser.push_block(newv);
+
+    // Setting variables might trigger an event handler, hence we need to unblock signals.
+    signal_unblock();
+    function_prepare_environment(func_name, p->get_argv() + 1, inherit_vars);
+    signal_block();
+
+    parser.forbid_function(func_name);
+    internal_exec_helper(parser, def, def_tree, NODE_OFFSET_INVALID, TOP, io_chain);
+    parser.allow_function();
+    parser.pop_block();
+}
+
+/// Returns whether every process after the given one is an external command.
+static bool only_external_processes_follow(const process_t *p) {
+    for (const process_t *next = p->next; next != NULL; next = next->next) {
+        if (next->type != EXTERNAL) return false;
+    }
+    return true;
+}
+
+/// Returns whether the redirection is a pipe whose reader is already running.
+static bool redirection_is_to_running_reader(const io_data_t *io) {
+    return io != NULL && io->io_mode == IO_PIPE &&
+           static_cast<const io_pipe_t *>(io)->has_running_reader;
+}
+
+/// Writes builtin output to a pipe whose reader is running, or to the given fd if there is no
+/// redirection. A reader that has gone away is not an error.
+static void write_to_running_reader(const io_data_t *io, int fd, const wcstring &output) {
+    if (output.empty()) return;
+    if (io != NULL) fd = static_cast<const io_pipe_t *>(io)->pipe_fd[1];
+    const std::string narrow = wcs2string(output);
+    if (write_loop(fd, narrow.data(), narrow.size()) < 0 && errno != EPIPE) {
+        debug(0, WRITE_ERROR);
+        wperror(L"write");
+    }
+}
+
+/// Where output written to an fd of a process ends up once its redirections have been applied.
+struct output_target_t {
+    /// The fd to write to, or -1 if it was closed.
+    int fd;
+    /// If not NULL, the output is for this buffer, and is appended to it directly.
+    io_buffer_t *buffer;
+
+    explicit output_target_t(int f = -1, io_buffer_t *b = NULL) : fd(f), buffer(b) {}
+};
+
+/// Returns how many bytes can be written to an empty pipe without blocking.
+static size_t pipe_capacity(int fd) {
+#ifdef F_GETPIPE_SZ
+    int size = fcntl(fd, F_GETPIPE_SZ);
+    if (size > 0) return size;
+#else
+    UNUSED(fd);
+#endif
+    return PIPE_BUF;
+}
+
+/// Data to be written to a pipe by a writer thread, which owns the fd and closes it when done.
+struct pipe_writer_t {
+    int fd;
+    std::string data;
+};
+
+static void *pipe_writer_thread(void *param) {
+    pipe_writer_t *writer = static_cast<pipe_writer_t *>(param);
+    // The reader going away is not an error. SIGPIPE is blocked on this thread, so it is discarded.
+    if (write_loop(writer->fd, writer->data.data(), writer->data.size()) < 0 && errno != EPIPE) {
+        debug_safe(0, "Error while writing to stdout");
+        safe_perror("write_loop");
+    }
+    close(writer->fd);
+    delete writer;
+    return NULL;
+}
+
+/// Returns whether fish itself can open the file redirections in io_chain for a process of the job,
+/// without blocking. That is only the case for foreground jobs whose redirections are to regular
+/// files, or to files that don't exist yet. A FIFO for instance blocks until it has a reader, which
+/// would hang a background job's shell. This decides whether the output of a builtin, function or
+/// block is written with write_output_in_process instead of by a forked child, and whether an
+/// external command with file redirections can be started with posix_spawn.
+static bool can_open_redirections_in_process(const job_t *j, const io_chain_t &io_chain) {
+    if (!job_get_flag(j, JOB_FOREGROUND)) return false;
+    for (size_t idx = 0; idx < io_chain.size(); idx++) {
+        const io_data_t *io = io_chain.at(idx).get();
+        if (!redirection_is_to_real_file(io)) continue;
+        // A file that doesn't exist yet is created as a regular file.
+        struct stat buf;
+        const char *path = static_cast<const io_file_t *>(io)->filename_cstr;
+        if (stat(path, &buf) == 0 ? !S_ISREG(buf.st_mode) : errno != ENOENT) return false;
+    }
+    return true;
+}
+
+/// Writes the output of a builtin, function or block that ran in fish itself to where the
+/// redirections in io_chain send it, as a forked child would after applying them. next_pipe_fd
+/// points to the write end of the pipe to the next process of the job, if any, which may not be
+/// running yet. If the output for it doesn't fit in the pipe, it is written by a thread, which takes
+/// over the fd and sets *next_pipe_fd to -1. The other output is written before this returns.
+/// Returns false if a redirection could not be applied, after printing an error.
+static bool write_output_in_process(const io_chain_t &io_chain, const std::string &out,
+                                    const std::string &err, int *next_pipe_fd) {
+    std::map<int, output_target_t> targets;
+    std::vector<int> opened_fds;
+    bool success = true;
+
+    for (size_t idx = 0; idx < io_chain.size() && success; idx++) {
+        const io_data_t *io = io_chain.at(idx).get();
+        switch (io->io_mode) {
+            case IO_FILE: {
+                int fd = open_redirection_file(static_cast<const io_file_t *>(io));
+                if (fd < 0) {
+                    success = false;
+                    break;
+                }
+                set_cloexec(fd);
+                opened_fds.push_back(fd);
+                targets[io->fd] = output_target_t(fd);
+                break;
+            }
+            case IO_FD: {
+                const int old_fd = static_cast<const io_fd_t *>(io)->old_fd;
+                if (io->fd == old_fd) break;
+                std::map<int, output_target_t>::const_iterator old = targets.find(old_fd);
+                // Fail like a child's dup2 would for a closed fd. The shell's own fds, like the
+                // SIGCHLD pipe, are all close-on-exec and count as closed.
+                bool closed;
+                if (old == targets.end()) {
+                    const int flags = fcntl(old_fd, F_GETFD);
+                    closed = flags == -1 || (flags & FD_CLOEXEC);
+                } else {
+                    closed = old->second.fd < 0 && old->second.buffer == NULL;
+                }
+                if (closed) {
+                    errno = EBADF;
+                    report_redirection_error(io->fd);
+                    success = false;
+                    break;
+                }
+                targets[io->fd] = (old == targets.end()) ? output_target_t(old_fd) : old->second;
+                break;
+            }
+            case IO_CLOSE: {
+                targets[io->fd] = output_target_t(-1);
+                break;
+            }
+            case IO_PIPE: {
+                const io_pipe_t *io_pipe = static_cast<const io_pipe_t *>(io);
+                targets[io->fd] = output_target_t(io_pipe->pipe_fd[io_pipe->is_input ? 0 : 1]);
+                break;
+            }
+            case IO_BUFFER: {
+                io_buffer_t *io_buffer = static_cast<io_buffer_t *>(io_chain.at(idx).get());
+                targets[io->fd] = output_target_t(io_buffer->pipe_fd[1], io_buffer);
+                break;
+            }
         }
     }
 
-    // Now see if we have a redirection involving a file. The only one we allow is /dev/null, which
-    // we assume will not fail.
-    bool result = true;
-    if (chain_contains_redirection_to_real_file(job->block_io_chain()) ||
-        chain_contains_redirection_to_real_file(process->io_chain())) {
-        result = false;
+    if (success) {
+        const int fds[] = {STDOUT_FILENO, STDERR_FILENO};
+        const std::string *outputs[] = {&out, &err};
+
+        // Output for the next process goes to a thread if it would fill up the pipe.
+        std::string pipe_data;
+        for (size_t i = 0; i < 2; i++) {
+            std::map<int, output_target_t>::const_iterator target = targets.find(fds[i]);
+            if (next_pipe_fd != NULL && target != targets.end() &&
+                target->second.fd == *next_pipe_fd) {
+                pipe_data.append(*outputs[i]);
+            }
+        }
+        const bool use_writer_thread =
+            next_pipe_fd != NULL && pipe_data.size() > pipe_capacity(*next_pipe_fd);
+
+        for (size_t i = 0; i < 2; i++) {
+            if (outputs[i]->empty()) continue;
+            std::map<int, output_target_t>::const_iterator found = targets.find(fds[i]);
+            const output_target_t target =
+                (found == targets.end()) ? output_target_t(fds[i]) : found->second;
+            if (target.buffer != NULL) {
+                target.buffer->out_buffer_append(outputs[i]->data(), outputs[i]->size());
+            } else if (use_writer_thread && target.fd == *next_pipe_fd) {
+                continue;
+            } else if (write_loop(target.fd, outputs[i]->data(), outputs[i]->size()) < 0 &&
+                       errno != EPIPE && fds[i] == STDOUT_FILENO) {
+                // Report this the way a forked child would, since a wide stdio message would make
+                // later narrow ones to stderr disappear.
+                debug_safe(0, "Error while writing to stdout");
+                safe_perror("write_loop");
+            }
+        }
+
+        if (use_writer_thread) {
+            pipe_writer_t *writer = new pipe_writer_t();
+            writer->fd = *next_pipe_fd;
+            writer->data.swap(pipe_data);
+            if (iothread_spawn_detached(pipe_writer_thread, writer)) {
+                *next_pipe_fd = -1;
+            } else {
+                // We can't block here until the next process drains the pipe, since it is started
+                // after this returns. Leave it to a child.
+                if (execute_fork(false) == 0) {
+                    write_loop(writer->fd, writer->data.data(), writer->data.size());
+                    exit_without_destructors(0);
+                }
+                delete writer;
+            }
+        }
+    }
+
+    io_cleanup_fds(opened_fds);
+    return success;
+}
+
+static bool chain_contains_redirection_to_real_file(const io_chain_t &io_chain) {
+    bool result = false;
+    for (size_t idx = 0; idx < io_chain.size(); idx++) {
+        const io_data_t *io = io_chain.at(idx).get();
+        if (redirection_is_to_real_file(io)) {
+            result = true;
+            break;
+        }
     }
     return result;
 }
 
+/// Opens the file redirections in in_chain for a process started with posix_spawn, which has no
+/// good way to report a failure to open them itself (see issue #364). out_chain gets the chain with
+/// them replaced by fd redirections, and out_opened_fds the fds to close once the process has been
+/// started. The fds are close-on-exec and above every redirected fd, so the child only keeps the
+/// dup'd copies. This must only be used where opening the files can't block the shell (see
+/// can_use_posix_spawn_for_job).
+///
+/// If a file can't be opened, this undoes what it did, including creating files for noclobber
+/// redirections, and returns false. The process is then forked, and the child reports the error
+/// as usual.
+static bool open_files_for_spawn(const io_chain_t &in_chain, io_chain_t *out_chain,
+                                 std::vector<int> *out_opened_fds) {
+    int max_fd = 2;
+    for (size_t idx = 0; idx < in_chain.size(); idx++) {
+        max_fd = maxi(max_fd, in_chain.at(idx)->fd);
+    }
+
+    bool success = true;
+    io_chain_t result_chain;
+    std::vector<int> opened_fds;
+    std::vector<const char *> created_files;
+    for (size_t idx = 0; idx < in_chain.size() && success; idx++) {
+        const shared_ptr<io_data_t> &in = in_chain.at(idx);
+        if (in->io_mode != IO_FILE) {
+            result_chain.push_back(in);
+            continue;
+        }
+
+        const io_file_t *in_file = static_cast<const io_file_t *>(in.get());
+        int fd = open(in_file->filename_cstr, in_file->flags, OPEN_MASK);
+        if (fd >= 0 && fd <= max_fd) {
+            int moved_fd = fcntl(fd, F_DUPFD, max_fd + 1);
+            exec_close(fd);
+            fd = moved_fd;
+        }
+        if (fd < 0) {
+            success = false;
+            break;
+        }
+
+        set_cloexec(fd);
+        opened_fds.push_back(fd);
+        if (in_file->flags & O_EXCL) created_files.push_back(in_file->filename_cstr);
+        result_chain.push_back(shared_ptr<io_data_t>(new io_fd_t(in->fd, fd, false)));
+    }
+
+    if (success) {
+        out_chain->swap(result_chain);
+        out_opened_fds->swap(opened_fds);
+    } else {
+        io_cleanup_fds(opened_fds);
+        for (size_t i = 0; i < created_files.size(); i++) {
+            unlink(created_files.at(i));
+        }
+    }
+    return success;
+}
+
+// Returns whether we can use posix spawn for a given process in a given job. Per
+// https://github.com/fish-shell/fish-shell/issues/364 , error handling for file redirections is too
+// difficult with posix_spawn, so file redirections are opened by fish beforehand with
+// open_files_for_spawn. That is only allowed where opening them can't block the shell; other files,
+// such as FIFOs or files redirected by background jobs, need fork/exec. /dev/null is always fine.
+static bool can_use_posix_spawn_for_job(const job_t *job, const io_chain_t &io_chain) {
+    return !chain_contains_redirection_to_real_file(io_chain) ||
+           can_open_redirections_in_process(job, io_chain);
+}
+
 void exec_job(parser_t &parser, job_t *j) {
     pid_t pid = 0;
     sigset_t chldset;
@@ -375,9 +665,6 @@ void exec_job(parser_t &parser, job_t *j) {
     // will kick in.
     bool exec_error = false;
 
-    bool needs_keepalive = false;
-    process_t keepalive;
-
     CHECK(j, );
     CHECK_BLOCK();
 
@@ -434,6 +721,7 @@ void exec_job(parser_t &parser, job_t *j) {
         } else {
             job_set_flag(j, JOB_CONSTRUCTED, 1);
             j->first_process->completed = 1;
+            job_mark_changed(j);
             return;
         }
         DIE("this should be unreachable");
@@ -457,45 +745,18 @@ void exec_job(parser_t &parser, job_t *j) {
 
     signal_block();
 
-    // See if we need to create a group keepalive process. This is a process that we create to make
-    // sure that the process group doesn't die accidentally, and is often needed when a
-    // builtin/block/function is inside a pipeline, since that usually means we have to wait for one
-    // program to exit before continuing in the pipeline, causing the group leader to exit.
-    if (job_get_flag(j, JOB_CONTROL) && !exec_error) {
-        for (const process_t *p = j->first_process; p; p = p->next) {
-            if (p->type != EXTERNAL) {
-                if (p->next) {
-                    needs_keepalive = true;
-                    break;
-                }
-                if (p != j->first_process) {
-                    needs_keepalive = true;
-                    break;
-                }
-            }
-        }
-    }
-
-    if (needs_keepalive) {
-        // Call fork. No need to wait for threads since our use is confined and simple.
-        keepalive.pid = execute_fork(false);
-        if (keepalive.pid == 0) {
-            // Child
-            keepalive.pid = getpid();
-            set_child_group(j, &keepalive, 1);
-            pause();
-            exit_without_destructors(0);
-        } else {
-            // Parent
-            debug(2, L"Fork #%d, pid %d: keepalive fork for '%ls'", g_fork_count, keepalive.pid,
-                  j->command_wcstr());
-            set_child_group(j, &keepalive, 0);
-        }
-    }
+    // Remember how many forks there have been, to report how many this job needed.
+    const int fork_count_at_start = g_fork_count;
 
     // This loop loops over every process_t in the job, starting it as appropriate. This turns out
     // to be rather complex, since a process_t can be one of many rather different things.
     //
+    // The first process we fork becomes the leader of the job's process group, and the others join
+    // it. The group lasts until the leader is reaped, even if the leader exits before the rest of
+    // the job has been launched (e.g. while a function in the middle of the pipeline runs). fish
+    // does not reap it until the job is constructed (see process_mark_finished_children), so there
+    // is no need for a separate process to keep the group alive.
+    //
     // The loop also has to handle pipelining between the jobs.
     //
     // We can have up to three pipes "in flight" at a time:
@@ -507,6 +768,14 @@ void exec_job(parser_t &parser, job_t *j) {
     // We are careful to set these to -1 when closed, so if we exit the loop abruptly, we can still
     // close them.
     int pipe_current_read = -1, pipe_current_write = -1, pipe_next_read = -1;
+
+    // A function or block whose execution is put off until the processes reading its output have
+    // been launched, along with its IO chain and the pipe fds it uses.
+    process_t *deferred_process = NULL;
+    io_chain_t deferred_io_chain;
+    shared_ptr<io_pipe_t> deferred_pipe_write;
+    int deferred_read_fd = -1, deferred_write_fd = -1;
+
     for (process_t *p = j->first_process; p != NULL && !exec_error; p = p->next) {
         // The IO chain for this process. It starts with the block IO, then pipes, and then gets any
         // from the process.
@@ -613,6 +882,24 @@ void exec_job(parser_t &parser, job_t *j) {
             pipe_next_read = local_pipe[0];
         }
 
+        // A function or block that only feeds external commands can write straight into the pipe,
+        // provided those commands are running to drain it. So hold it back until the rest of the
+        // pipeline has been launched, instead of buffering all of its output. This is not done for
+        // jobs that get the terminal: those commands would own it while the function runs, and
+        // anything in the function reading from the terminal would be stopped with SIGTTIN.
+        if ((p->type == INTERNAL_FUNCTION || p->type == INTERNAL_BLOCK_NODE) && p->next &&
+            !(job_get_flag(j, JOB_TERMINAL) && job_get_flag(j, JOB_FOREGROUND)) &&
+            only_external_processes_follow(p)) {
+            deferred_process = p;
+            deferred_io_chain = process_net_io_chain;
+            deferred_pipe_write = pipe_write;
+            deferred_read_fd = pipe_current_read;
+            deferred_write_fd = pipe_current_write;
+            pipe_current_read = -1;
+            pipe_current_write = -1;
+            continue;
+        }
+
         // This is the IO buffer we use for storing the output of a block or function when it is in
         // a pipeline.
         shared_ptr<io_buffer_t> block_output_io_buffer;
@@ -621,34 +908,8 @@ void exec_job(parser_t &parser, job_t *j) {
         std::auto_ptr<io_streams_t> builtin_io_streams;
 
         switch (p->type) {
-            case INTERNAL_FUNCTION: {
-                // Calls to function_get_definition might need to source a file as a part of
-                // autoloading, hence there must be no blocks.
-                signal_unblock();
-                const wcstring func_name = p->argv0();
-                wcstring def;
-                bool function_exists = function_get_definition(func_name, &def);
-                bool shadow_scope = function_get_shadow_scope(func_name);
-                const std::map<wcstring, env_var_t> inherit_vars =
-                    function_get_inherit_vars(func_name);
-
-                signal_block();
-
-                if (!function_exists) {
-                    debug(0, _(L"Unknown function '%ls'"), p->argv0());
-                    break;
-                }
-                function_block_t *newv = new function_block_t(p, func_name, shadow_scope);
-                parser.push_block(newv);
-
-                // Setting variables might trigger an event handler, hence we need to unblock
-                // signals.
-                signal_unblock();
-                function_prepare_environment(func_name, p->get_argv() + 1, inherit_vars);
-                signal_block();
-
-                parser.forbid_function(func_name);
-
+            case INTERNAL_FUNCTION:
+            case INTERNAL_BLOCK_NODE: {
                 if (p->next) {
                     // Be careful to handle failure, e.g. too many open fds.
                     block_output_io_buffer.reset(io_buffer_t::create(STDOUT_FILENO, all_ios));
@@ -665,33 +926,7 @@ void exec_job(parser_t &parser, job_t *j) {
                 }
 
                 if (!exec_error) {
-                    internal_exec_helper(parser, def, NODE_OFFSET_INVALID, TOP,
-                                         process_net_io_chain);
-                }
-
-                parser.allow_function();
-                parser.pop_block();
-
-                break;
-            }
-
-            case INTERNAL_BLOCK_NODE: {
-                if (p->next) {
-                    block_output_io_buffer.reset(io_buffer_t::create(STDOUT_FILENO, all_ios));
-                    if (block_output_io_buffer.get() == NULL) {
-                        // We failed (e.g. no more fds could be created).
-                        exec_error = true;
-                        job_mark_process_as_failed(j, p);
-                    } else {
-                        // See the comment above about it's OK to add an IO redirection to this
-                        // local buffer, even though it won't be handled in select_try.
-                        process_net_io_chain.push_back(block_output_io_buffer);
-                    }
-                }
-
-                if (!exec_error) {
-                    internal_exec_helper(parser, wcstring(), p->internal_block_node, TOP,
-                                         process_net_io_chain);
+                    exec_internal_process(parser, p, process_net_io_chain);
                 }
                 break;
             }
@@ -856,7 +1091,7 @@ void exec_job(parser_t &parser, job_t *j) {
                 const char *buffer = block_output_io_buffer->out_buffer_ptr();
                 size_t count = block_output_io_buffer->out_buffer_size();
 
-                if (block_output_io_buffer->out_buffer_size() > 0) {
+                if (count > 0 && !can_open_redirections_in_process(j, process_net_io_chain)) {
                     // We don't have to drain threads here because our child process is simple.
                     pid = execute_fork(false);
                     if (pid == 0) {
@@ -871,10 +1106,17 @@ void exec_job(parser_t &parser, job_t *j) {
                         debug(2, L"Fork #%d, pid %d: internal block or function for '%ls'",
                               g_fork_count, pid, p->argv0());
                         p->pid = pid;
+                        if (pid > 0) job_index_process(j, p);
                         set_child_group(j, p, 0);
                     }
-
                 } else {
+                    // Pass the output on to the rest of the pipeline, the same way as for
+                    // builtins.
+                    if (count > 0 &&
+                        !write_output_in_process(process_net_io_chain, std::string(buffer, count),
+                                                 std::string(), &pipe_current_write)) {
+                        status = STATUS_BUILTIN_ERROR;
+                    }
                     if (p->next == 0) {
                         proc_set_last_status(job_get_flag(j, JOB_NEGATE) ? (!status) : status);
                     }
@@ -886,12 +1128,10 @@ void exec_job(parser_t &parser, job_t *j) {
             }
 
             case INTERNAL_BUILTIN: {
-                // Handle output from builtin commands. In the general case, this means forking of a
-                // worker process, that will write out the contents of the stdout and stderr buffers
-                // to the correct file descriptor. Since forking is expensive, fish tries to avoid
-                // it when possible.
-                bool fork_was_skipped = false;
-
+                // Handle output from builtin commands. In the general case, this means writing the
+                // contents of the stdout and stderr buffers to where the redirections send them,
+                // which fish does itself where it can instead of forking a process for it.
+                bool forked_writer = false;
                 const shared_ptr<io_data_t> stdout_io =
                     process_net_io_chain.get_io_for_fd(STDOUT_FILENO);
                 const shared_ptr<io_data_t> stderr_io =
@@ -903,61 +1143,65 @@ void exec_job(parser_t &parser, job_t *j) {
 
                 // If we are outputting to a file, we have to actually do it, even if we have no
                 // output, so that we can truncate the file. Does not apply to /dev/null.
-                bool must_fork = redirection_is_to_real_file(stdout_io.get()) ||
-                                 redirection_is_to_real_file(stderr_io.get());
-                if (!must_fork && p->next == NULL) {
-                    const bool stdout_is_to_buffer = stdout_io && stdout_io->io_mode == IO_BUFFER;
-                    const bool no_stdout_output = stdout_buffer.empty();
-                    const bool no_stderr_output = stderr_buffer.empty();
-
-                    if (no_stdout_output && no_stderr_output) {
-                        // The builtin produced no output and is not inside of a pipeline. No
-                        // need to fork or even output anything.
-                        debug(3, L"Skipping fork: no output for internal builtin '%ls'",
-                              p->argv0());
-                        fork_was_skipped = true;
-                    } else if (no_stderr_output && stdout_is_to_buffer) {
-                        // The builtin produced no stderr, and its stdout is going to an
-                        // internal buffer. There is no need to fork. This helps out the
-                        // performance quite a bit in complex completion code.
-                        debug(3, L"Skipping fork: buffered output for internal builtin '%ls'",
-                              p->argv0());
-
-                        io_buffer_t *io_buffer = static_cast<io_buffer_t *>(stdout_io.get());
-                        const std::string res = wcs2string(builtin_io_streams->out.buffer());
-
-                        io_buffer->out_buffer_append(res.data(), res.size());
-                        fork_was_skipped = true;
-                    } else if (stdout_io.get() == NULL && stderr_io.get() == NULL) {
-                        // We are writing to normal stdout and stderr. Just do it - no need to
-                        // fork.
-                        debug(3, L"Skipping fork: ordinary output for internal builtin '%ls'",
-                              p->argv0());
-                        const std::string outbuff = wcs2string(stdout_buffer);
-                        const std::string errbuff = wcs2string(stderr_buffer);
-                        bool builtin_io_done = do_builtin_io(outbuff.data(), outbuff.size(),
-                                                             errbuff.data(), errbuff.size());
-                        if (!builtin_io_done && errno != EPIPE) {
-                            show_stackframe(L'E');
-                        }
-                        fork_was_skipped = true;
+                const bool must_open_files = redirection_is_to_real_file(stdout_io.get()) ||
+                                             redirection_is_to_real_file(stderr_io.get());
+                const bool no_stdout_output = stdout_buffer.empty();
+                const bool no_stderr_output = stderr_buffer.empty();
+                const bool stdout_is_to_buffer = stdout_io && stdout_io->io_mode == IO_BUFFER;
+
+                if (!must_open_files && p->next == NULL && no_stdout_output &&
+                    no_stderr_output) {
+                    // The builtin produced no output and is not inside of a pipeline. No need to
+                    // output anything.
+                    debug(3, L"Skipping output: no output for internal builtin '%ls'",
+                          p->argv0());
+                } else if (!must_open_files && p->next == NULL && no_stderr_output &&
+                           stdout_is_to_buffer) {
+                    // The builtin produced no stderr, and its stdout is going to an internal
+                    // buffer. This helps out the performance quite a bit in complex completion
+                    // code.
+                    debug(3, L"Buffered output for internal builtin '%ls'", p->argv0());
+
+                    io_buffer_t *io_buffer = static_cast<io_buffer_t *>(stdout_io.get());
+                    const std::string res = wcs2string(builtin_io_streams->out.buffer());
+
+                    io_buffer->out_buffer_append(res.data(), res.size());
+                } else if (!must_open_files && p->next == NULL &&
+                           redirection_is_to_running_reader(stdout_io.get()) &&
+                           (stderr_io.get() == NULL ||
+                            redirection_is_to_running_reader(stderr_io.get()))) {
+                    // The builtin is writing into a pipe that is being drained, e.g. inside a
+                    // function piped to an external command. Write to it directly.
+                    debug(3, L"Streaming output for internal builtin '%ls'", p->argv0());
+                    write_to_running_reader(stdout_io.get(), STDOUT_FILENO, stdout_buffer);
+                    write_to_running_reader(stderr_io.get(), STDERR_FILENO, stderr_buffer);
+                } else if (!must_open_files && p->next == NULL && stdout_io.get() == NULL &&
+                           stderr_io.get() == NULL) {
+                    // We are writing to normal stdout and stderr. Just do it.
+                    debug(3, L"Ordinary output for internal builtin '%ls'", p->argv0());
+                    const std::string outbuff = wcs2string(stdout_buffer);
+                    const std::string errbuff = wcs2string(stderr_buffer);
+                    bool builtin_io_done = do_builtin_io(outbuff.data(), outbuff.size(),
+                                                         errbuff.data(), errbuff.size());
+                    if (!builtin_io_done && errno != EPIPE) {
+                        show_stackframe(L'E');
                     }
-                }
-
-                if (fork_was_skipped) {
-                    p->completed = 1;
-                    if (p->next == 0) {
-                        debug(3, L"Set status of %ls to %d using short circuit", j->command_wcstr(),
-                              p->status);
-
-                        int status = p->status;
-                        proc_set_last_status(job_get_flag(j, JOB_NEGATE) ? (!status) : status);
+                } else if (can_open_redirections_in_process(j, process_net_io_chain)) {
+                    // Apply the redirections and write the output ourselves. The next process in the
+                    // pipeline hasn't been started yet, so output that doesn't fit in the pipe to it
+                    // is left to a thread.
+                    debug(3, L"Redirected output for internal builtin '%ls'", p->argv0());
+                    const std::string outbuff = wcs2string(stdout_buffer);
+                    const std::string errbuff = wcs2string(stderr_buffer);
+                    if (!write_output_in_process(process_net_io_chain, outbuff, errbuff,
+                                                 p->next ? &pipe_current_write : NULL)) {
+                        p->status = STATUS_BUILTIN_ERROR;
                     }
                 } else {
-                    // Ok, unfortunately, we have to do a real fork. Bummer. We work hard to make
-                    // sure we don't have to wait for all our threads to exit, by arranging things
-                    // so that we don't have to allocate memory or do anything except system calls
-                    // in the child.
+                    // Fork a child that applies the redirections and writes the output. We work
+                    // hard to make sure we don't have to wait for all our threads to exit, by
+                    // arranging things so that we don't have to allocate memory or do anything
+                    // except system calls in the child.
                     //
                     // These strings may contain embedded nulls, so don't treat them as C strings.
                     const std::string outbuff_str = wcs2string(stdout_buffer);
@@ -984,11 +1228,21 @@ void exec_job(parser_t &parser, job_t *j) {
                         debug(2, L"Fork #%d, pid %d: internal builtin for '%ls'", g_fork_count, pid,
                               p->argv0());
                         p->pid = pid;
-
+                        if (pid > 0) job_index_process(j, p);
                         set_child_group(j, p, 0);
                     }
+                    forked_writer = true;
                 }
 
+                if (forked_writer) break;
+                p->completed = 1;
+                if (p->next == 0) {
+                    debug(3, L"Set status of %ls to %d using short circuit", j->command_wcstr(),
+                          p->status);
+
+                    int status = p->status;
+                    proc_set_last_status(job_get_flag(j, JOB_NEGATE) ? (!status) : status);
+                }
                 break;
             }
 
@@ -1014,15 +1268,26 @@ void exec_job(parser_t &parser, job_t *j) {
                 const wchar_t *file = reader_current_filename();
 
 #if FISH_USE_POSIX_SPAWN
-                // Prefer to use posix_spawn, since it's faster on some systems like OS X.
-                bool use_posix_spawn = g_use_posix_spawn && can_use_posix_spawn_for_job(j, p);
+                // Prefer to use posix_spawn, since it doesn't have to copy the shell's address
+                // space. That includes foreground jobs: the child may try to use the terminal
+                // before set_child_group gives it the terminal below, in which case it is stopped
+                // by SIGTTIN or SIGTTOU, and continued again when we see that (see
+                // handle_child_status).
+                //
+                // File redirections are opened here first, since a spawned child can't report a
+                // failure to open them.
+                io_chain_t spawn_io_chain;
+                std::vector<int> spawn_opened_fds;
+                bool use_posix_spawn =
+                    g_use_posix_spawn && can_use_posix_spawn_for_job(j, process_net_io_chain) &&
+                    open_files_for_spawn(process_net_io_chain, &spawn_io_chain, &spawn_opened_fds);
                 if (use_posix_spawn) {
                     g_fork_count++;  // spawn counts as a fork+exec
                     // Create posix spawn attributes and actions.
                     posix_spawnattr_t attr = posix_spawnattr_t();
                     posix_spawn_file_actions_t actions = posix_spawn_file_actions_t();
                     bool made_it = fork_actions_make_spawn_properties(&attr, &actions, j, p,
-                                                                      process_net_io_chain);
+                                                                      spawn_io_chain);
                     if (made_it) {
                         // We successfully made the attributes and actions; actually call
                         // posix_spawn.
@@ -1044,6 +1309,7 @@ void exec_job(parser_t &parser, job_t *j) {
                         posix_spawn_file_actions_destroy(&actions);
                         posix_spawnattr_destroy(&attr);
                     }
+                    io_cleanup_fds(spawn_opened_fds);
 
                     // A 0 pid means we failed to posix_spawn. Since we have no pid, we'll never get
                     // told when it's exited, so we have to mark the process as failed.
@@ -1077,6 +1343,7 @@ void exec_job(parser_t &parser, job_t *j) {
                 // This is the parent process. Store away information on the child, and possibly
                 // fice it control over the terminal.
                 p->pid = pid;
+                if (pid > 0) job_index_process(j, p);
                 set_child_group(j, p, 0);
                 break;
             }
@@ -1106,15 +1373,25 @@ void exec_job(parser_t &parser, job_t *j) {
     if (pipe_current_write >= 0) exec_close(pipe_current_write);
     if (pipe_next_read >= 0) exec_close(pipe_next_read);
 
-    // The keepalive process is no longer needed, so we terminate it with extreme prejudice.
-    if (needs_keepalive) {
-        kill(keepalive.pid, SIGKILL);
+    // Now that its readers are running, run the deferred function or block. Its output streams into
+    // the pipe as it is produced. If launching the readers failed, writes fail with EPIPE instead.
+    if (deferred_process != NULL) {
+        // The read end was handed to the next process and has since been closed here.
+        deferred_pipe_write->pipe_fd[0] = -1;
+        deferred_pipe_write->has_running_reader = true;
+        exec_internal_process(parser, deferred_process, deferred_io_chain);
+        if (deferred_read_fd >= 0) exec_close(deferred_read_fd);
+        exec_close(deferred_write_fd);
+        deferred_process->completed = 1;
     }
 
     signal_unblock();
-    debug(3, L"Job is constructed");
+    debug(3, L"Job is constructed, using %d forks", g_fork_count - fork_count_at_start);
 
+    // Processes that ran in-process have completed without a status change being reported, so make
+    // sure the job is looked at when reaping.
     job_set_flag(j, JOB_CONSTRUCTED, 1);
+    job_mark_changed(j);
     if (!job_get_flag(j, JOB_FOREGROUND)) {
         proc_last_bg_pid = j->pgid;
     }
@@ -1128,8 +1405,90 @@ void exec_job(parser_t &parser, job_t *j) {
     }
 }
 
+int exec_external_capture(const wcstring &path, const wcstring_list_t &argv,
+                          const std::string &input, std::string *out, std::string *err) {
+    ASSERT_IS_MAIN_THREAD();
+    const int prev_status = proc_get_last_status();
+
+    // IO buffer creation may fail (e.g. if we have too many open files to make a pipe).
+    const shared_ptr<io_buffer_t> out_buffer(io_buffer_t::create(STDOUT_FILENO, io_chain_t()));
+    if (out_buffer.get() == NULL) return -1;
+    io_chain_t ios(out_buffer);
+    const shared_ptr<io_buffer_t> err_buffer(io_buffer_t::create(STDERR_FILENO, ios));
+    if (err_buffer.get() == NULL) return -1;
+    ios.push_back(err_buffer);
+
+    int in_pipe[2] = {-1, -1};
+    if (exec_pipe(in_pipe) == -1 || !pipe_avoid_conflicts_with_io_chain(in_pipe, ios)) {
+        debug(1, PIPE_ERROR);
+        wperror(L"pipe");
+        return -1;
+    }
+    ios.push_back(shared_ptr<io_data_t>(new io_fd_t(STDIN_FILENO, in_pipe[0], false)));
+
+    // Hand the input over before launching, since the job is waited for. Input that doesn't fit in
+    // the pipe is written by a thread.
+    if (input.size() > pipe_capacity(in_pipe[1])) {
+        pipe_writer_t *writer = new pipe_writer_t();
+        writer->fd = in_pipe[1];
+        writer->data = input;
+        if (iothread_spawn_detached(pipe_writer_thread, writer)) {
+            in_pipe[1] = -1;
+        } else {
+            delete writer;
+        }
+    } else {
+        write_loop(in_pipe[1], input.data(), input.size());
+    }
+    if (in_pipe[1] >= 0) exec_close(in_pipe[1]);
+
+    // The command is a job of its own, without job control or the terminal, like the jobs of a
+    // command substitution.
+    process_t *p = new process_t();
+    p->type = EXTERNAL;
+    p->set_argv(argv);
+    p->actual_cmd = path;
+
+    job_t *j = new job_t(acquire_job_id(), ios);
+    j->first_process = p;
+    j->set_command(argv.empty() ? path : argv.front());
+    job_set_flag(j, JOB_FOREGROUND, 1);
+    job_set_flag(j, JOB_SKIP_NOTIFICATION, 1);
+
+    parser_t &parser = parser_t::principal_parser();
+    parser.job_add(j);
+    exec_job(parser, j);
+    exec_close(in_pipe[0]);
+
+    // The job is freed by job_reap once it has completed.
+    const int status = (p->pid > 0 && p->completed) ? p->status : -1;
+    out_buffer->read();
+    err_buffer->read();
+    out->assign(out_buffer->out_buffer_ptr() ? out_buffer->out_buffer_ptr() : "",
+                out_buffer->out_buffer_size());
+    err->assign(err_buffer->out_buffer_ptr() ? err_buffer->out_buffer_ptr() : "",
+                err_buffer->out_buffer_size());
+    job_reap(0);
+
+    proc_set_last_status(prev_status);
+    return status;
+}
+
+/// Returns the maximum number of bytes of output a command substitution may produce, taken from the
+/// fish_read_limit variable. Returns 0, meaning no limit, if the variable is unset or invalid.
+static size_t get_read_limit() {
+    const env_var_t limit_var = env_get_string(L"fish_read_limit");
+    if (limit_var.missing_or_empty()) return 0;
+
+    wchar_t *end;
+    errno = 0;
+    long limit = wcstol(limit_var.c_str(), &end, 10);
+    if (errno || *end != L'\0' || limit < 0) return 0;
+    return static_cast<size_t>(limit);
+}
+
 static int exec_subshell_internal(const wcstring &cmd, wcstring_list_t *lst,
-                                  bool apply_exit_status) {
+                                  bool apply_exit_status, bool *out_discarded) {
     ASSERT_IS_MAIN_THREAD();
     int prev_subshell = is_subshell;
     const int prev_status = proc_get_last_status();
@@ -1146,48 +1505,41 @@ static int exec_subshell_internal(const wcstring &cmd, wcstring_list_t *lst,
     is_subshell = 1;
 
     int subcommand_status = -1;  // assume the worst
+    bool discarded = false;
 
     // IO buffer creation may fail (e.g. if we have too many open files to make a pipe), so this may
     // be null.
     const shared_ptr<io_buffer_t> io_buffer(io_buffer_t::create(STDOUT_FILENO, io_chain_t()));
     if (io_buffer.get() != NULL) {
+        // Split the output into lines while it is being read, so it is not held in memory twice.
+        if (lst != NULL && split_output) io_buffer->set_split_lines();
+        io_buffer->set_read_limit(get_read_limit());
+
         parser_t &parser = parser_t::principal_parser();
         if (parser.eval(cmd, io_chain_t(io_buffer), SUBST) == 0) {
             subcommand_status = proc_get_last_status();
         }
 
         io_buffer->read();
+        discarded = io_buffer->output_discarded();
+        if (discarded) subcommand_status = STATUS_READ_TOO_MUCH;
     }
 
     // If the caller asked us to preserve the exit status, restore the old status. Otherwise set the
     // status of the subcommand.
     proc_set_last_status(apply_exit_status ? subcommand_status : prev_status);
     is_subshell = prev_subshell;
+    if (out_discarded != NULL) *out_discarded = discarded;
 
-    if (lst == NULL || io_buffer.get() == NULL) {
+    if (lst == NULL || io_buffer.get() == NULL || discarded) {
         return subcommand_status;
     }
 
-    const char *begin = io_buffer->out_buffer_ptr();
-    const char *end = begin + io_buffer->out_buffer_size();
     if (split_output) {
-        const char *cursor = begin;
-        while (cursor < end) {
-            // Look for the next separator.
-            const char *stop = (const char *)memchr(cursor, '\n', end - cursor);
-            const bool hit_separator = (stop != NULL);
-            if (!hit_separator) {
-                // If it's not found, just use the end.
-                stop = end;
-            }
-            // Stop now points at the first character we do not want to copy.
-            const wcstring wc = str2wcstring(cursor, stop - cursor);
-            lst->push_back(wc);
-
-            // If we hit a separator, skip over it; otherwise we're at the end.
-            cursor = stop + (hit_separator ? 1 : 0);
-        }
+        io_buffer->take_lines(lst);
     } else {
+        const char *begin = io_buffer->out_buffer_ptr();
+        const char *end = begin + io_buffer->out_buffer_size();
         // We're not splitting output, but we still want to trim off a trailing newline.
         if (end != begin && end[-1] == '\n') {
             --end;
@@ -1199,12 +1551,13 @@ static int exec_subshell_internal(const wcstring &cmd, wcstring_list_t *lst,
     return subcommand_status;
 }
 
-int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool apply_exit_status) {
+int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool apply_exit_status,
+                  bool *out_discarded) {
     ASSERT_IS_MAIN_THREAD();
-    return exec_subshell_internal(cmd, &outputs, apply_exit_status);
+    return exec_subshell_internal(cmd, &outputs, apply_exit_status, out_discarded);
 }
 
 int exec_subshell(const wcstring &cmd, bool apply_exit_status) {
     ASSERT_IS_MAIN_THREAD();
-    return exec_subshell_internal(cmd, NULL, apply_exit_status);
+    return exec_subshell_internal(cmd, NULL, apply_exit_status, NULL);
 }
@@ -3,6 +3,7 @@
 #define FISH_EXEC_H
 
 #include <stddef.h>
+#include <string>
 #include <vector>
 
 #include "common.h"
@@ -32,11 +33,22 @@ void exec_job(parser_t &parser, job_t *j);
 ///
 /// \param cmd the command to execute
 /// \param outputs The list to insert output into.
+/// \param out_discarded If not null, set to whether the output exceeded fish_read_limit and was
+/// discarded.
 ///
 /// \return the status of the last job to exit, or -1 if en error was encountered.
-int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool preserve_exit_status);
+int exec_subshell(const wcstring &cmd, std::vector<wcstring> &outputs, bool preserve_exit_status,
+                  bool *out_discarded = NULL);
 int exec_subshell(const wcstring &cmd, bool preserve_exit_status);
 
+/// Runs the external command at \c path with the given arguments as a job of its own, feeding it
+/// \c input on stdin and collecting what it writes to stdout and stderr. The command doesn't get
+/// the terminal. The last status is left unchanged.
+///
+/// \return the wait status of the command, or -1 if it could not be started or did not finish.
+int exec_external_capture(const wcstring &path, const wcstring_list_t &argv,
+                          const std::string &input, std::string *out, std::string *err);
+
 /// Loops over close until the syscall was run without being interrupted.
 void exec_close(int fd);
 
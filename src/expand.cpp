@@ -12,6 +12,7 @@
 #include <wchar.h>
 #include <wctype.h>
 #include <algorithm>
+#include <map>
 #ifdef HAVE_SYS_SYSCTL_H
 #include <sys/sysctl.h>  // IWYU pragma: keep
 #endif
@@ -791,11 +792,10 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
 
         if (!var_val.missing()) {
             int all_vars = 1;
-            wcstring_list_t var_item_list;
+            const wcstring_list_t &all_items = var_val.as_list();
+            wcstring_list_t sliced_items;
 
             if (is_ok) {
-                tokenize_variable_array(var_val, var_item_list);
-
                 const size_t slice_start = stop_pos;
                 if (slice_start < insize && instr.at(slice_start) == L'[') {
                     wchar_t *slice_end;
@@ -803,7 +803,7 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                     all_vars = 0;
                     const wchar_t *in = instr.c_str();
                     bad_pos = parse_slice(in + slice_start, &slice_end, var_idx_list, var_pos_list,
-                                          var_item_list.size());
+                                          all_items.size());
                     if (bad_pos != 0) {
                         append_syntax_error(errors, stop_pos + bad_pos, L"Invalid index value");
                         is_ok = false;
@@ -818,7 +818,7 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                         long tmp = var_idx_list.at(j);
                         // Check that we are within array bounds. If not, truncate the list to
                         // exit.
-                        if (tmp < 1 || (size_t)tmp > var_item_list.size()) {
+                        if (tmp < 1 || (size_t)tmp > all_items.size()) {
                             size_t var_src_pos = var_pos_list.at(j);
                             // The slice was parsed starting at stop_pos, so we have to add that
                             // to the error position.
@@ -832,18 +832,19 @@ static int expand_variables(const wcstring &instr, std::vector<completion_t> *ou
                             // at the specified index.
                             // al_set( var_idx_list, j, wcsdup((const wchar_t *)al_get(
                             // &var_item_list, tmp-1 ) ) );
-                            string_values.at(j) = var_item_list.at(tmp - 1);
+                            string_values.at(j) = all_items.at(tmp - 1);
                         }
                     }
 
-                    // string_values is the new var_item_list.
-                    var_item_list.swap(string_values);
+                    // string_values are the elements the slice selected.
+                    sliced_items.swap(string_values);
                 }
             }
 
             if (!is_ok) {
                 return is_ok;
             }
+            const wcstring_list_t &var_item_list = all_vars ? all_items : sliced_items;
 
             if (is_single) {
                 wcstring res(instr, 0, i);
@@ -1083,7 +1084,15 @@ static int expand_cmdsubst(const wcstring &input, std::vector<completion_t> *out
 
     const wcstring subcmd(paran_begin + 1, paran_end - paran_begin - 1);
 
-    if (exec_subshell(subcmd, sub_res, true /* do apply exit status */) == -1) {
+    bool output_discarded = false;
+    int subshell_status =
+        exec_subshell(subcmd, sub_res, true /* do apply exit status */, &output_discarded);
+    if (output_discarded) {
+        append_cmdsub_error(errors, SOURCE_LOCATION_UNKNOWN,
+                            _(L"Too much data emitted by command substitution so it was discarded"));
+        return 0;
+    }
+    if (subshell_status == -1) {
         append_cmdsub_error(errors, SOURCE_LOCATION_UNKNOWN,
                             L"Unknown error while evaulating command substitution");
         return 0;
@@ -1586,20 +1595,24 @@ bool fish_xdm_login_hack_hack_hack_hack(std::vector<std::string> *cmds, int argc
     return result;
 }
 
-bool expand_abbreviation(const wcstring &src, wcstring *output) {
-    if (src.empty()) return false;
+/// Abbreviations parsed from USER_ABBREVIATIONS_VARIABLE_NAME, by the command they expand. They are
+/// parsed when first needed after the variable changes. Abbreviations are expanded while
+/// highlighting in the background, so they are protected by a lock.
+typedef std::map<wcstring, wcstring> abbreviation_map_t;
+static pthread_mutex_t abbreviations_lock = PTHREAD_MUTEX_INITIALIZER;
+static abbreviation_map_t abbreviations;
+static bool abbreviations_valid = false;
 
-    // Get the abbreviations. Return false if we have none.
-    env_var_t var = env_get_string(USER_ABBREVIATIONS_VARIABLE_NAME);
-    if (var.missing_or_empty()) return false;
+/// Parses the abbreviations in the variable into the table.
+static void parse_abbreviations(const env_var_t &var, abbreviation_map_t *table) {
+    table->clear();
+    if (var.missing_or_empty()) return;
 
-    bool result = false;
     wcstring line;
     wcstokenizer tokenizer(var, ARRAY_SEP_STR);
     while (tokenizer.next(line)) {
         // Line is expected to be of the form 'foo=bar' or 'foo bar'. Parse out the first = or
-        // space. Silently skip on failure (no equals, or equals at the end or beginning). Try to
-        // avoid copying any strings until we are sure this is a match.
+        // space. Silently skip on failure (no equals, or equals at the end or beginning).
         size_t equals_pos = line.find(L'=');
         size_t space_pos = line.find(L' ');
         size_t separator = mini(equals_pos, space_pos);
@@ -1609,14 +1622,28 @@ bool expand_abbreviation(const wcstring &src, wcstring *output) {
         size_t cmd_end = separator;
         while (cmd_end > 0 && iswspace(line.at(cmd_end - 1))) cmd_end--;
 
-        // See if this command matches.
-        if (line.compare(0, cmd_end, src) == 0) {
-            // Success. Set output to everything past the end of the string.
-            if (output != NULL) output->assign(line, separator + 1, wcstring::npos);
+        // The first abbreviation for a command wins, so don't replace an existing one.
+        table->insert(abbreviation_map_t::value_type(wcstring(line, 0, cmd_end),
+                                                     wcstring(line, separator + 1)));
+    }
+}
 
-            result = true;
-            break;
-        }
+void expand_abbreviations_changed() {
+    scoped_lock locker(abbreviations_lock);
+    abbreviations_valid = false;
+}
+
+bool expand_abbreviation(const wcstring &src, wcstring *output) {
+    if (src.empty()) return false;
+
+    scoped_lock locker(abbreviations_lock);
+    if (!abbreviations_valid) {
+        parse_abbreviations(env_get_string(USER_ABBREVIATIONS_VARIABLE_NAME), &abbreviations);
+        abbreviations_valid = true;
     }
-    return result;
+
+    abbreviation_map_t::const_iterator where = abbreviations.find(src);
+    if (where == abbreviations.end()) return false;
+    if (output != NULL) output->assign(where->second);
+    return true;
 }
@@ -148,6 +148,9 @@ wcstring replace_home_directory_with_tilde(const wcstring &str);
 #define USER_ABBREVIATIONS_VARIABLE_NAME L"fish_user_abbreviations"
 bool expand_abbreviation(const wcstring &src, wcstring *output);
 
+/// Tells abbreviation expansion that the abbreviations variable may have a new value.
+void expand_abbreviations_changed();
+
 // Terrible hacks
 bool fish_xdm_login_hack_hack_hack_hack(std::vector<std::string> *cmds, int argc,
                                         const char *const *argv);
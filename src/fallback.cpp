@@ -260,6 +260,23 @@ int killpg(int pgr, int sig) {
 }
 #endif
 
+#ifndef HAVE_MEMMEM
+void *memmem(const void *haystack, size_t haystack_len, const void *needle, size_t needle_len) {
+    if (needle_len == 0) return (void *)haystack;
+    const char *h = (const char *)haystack;
+    const char *n = (const char *)needle;
+    while (haystack_len >= needle_len) {
+        // Find the first byte, then compare the rest.
+        const char *first = (const char *)memchr(h, n[0], haystack_len - needle_len + 1);
+        if (first == NULL) break;
+        if (!memcmp(first, n, needle_len)) return (void *)first;
+        haystack_len -= (first - h) + 1;
+        h = first + 1;
+    }
+    return NULL;
+}
+#endif
+
 // Big hack to use our versions of wcswidth where we know them to be broken, which is
 // EVERYWHERE (https://github.com/fish-shell/fish-shell/issues/2199)
 #ifndef HAVE_BROKEN_WCWIDTH
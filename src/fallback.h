@@ -108,6 +108,12 @@ int srand48_r(long int seedval, struct drand48_data *buffer);
 int futimes(int fd, const struct timeval *times);
 #endif
 
+#ifndef HAVE_MEMMEM
+/// Fallback for memmem. Returns a pointer to the first occurrence of \c needle in \c haystack, or
+/// NULL if there is none.
+void *memmem(const void *haystack, size_t haystack_len, const void *needle, size_t needle_len);
+#endif
+
 // autoconf may fail to detect gettext (645), so don't define a function call gettext or we'll get
 // build errors.
 
@@ -34,6 +34,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
 #include <wchar.h>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "builtin.h"
@@ -61,6 +62,38 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
 /// If we are doing profiling, the filename to output to.
 static const char *s_profiling_output_filename = NULL;
 
+/// Whether to print how long each phase of startup took (--print-startup-timing).
+static bool s_print_startup_timing = false;
+/// When startup began, and the phases of startup with the times they ended.
+static double s_startup_time = 0;
+static std::vector<std::pair<const wchar_t *, double> > s_startup_phases;
+
+/// Records that the given phase of startup has ended.
+static void mark_startup_phase(const wchar_t *name) {
+    if (s_print_startup_timing) s_startup_phases.push_back(std::make_pair(name, timef()));
+}
+
+/// Prints the time taken by each phase of startup to stderr, if we were asked to.
+static void print_startup_timing() {
+    if (!s_print_startup_timing) return;
+    s_print_startup_timing = false;
+
+    double phase_start = s_startup_time;
+    for (size_t i = 0; i < s_startup_phases.size(); i++) {
+        const std::pair<const wchar_t *, double> &phase = s_startup_phases.at(i);
+        fwprintf(stderr, L"%-20ls %8.2f ms\n", phase.first, (phase.second - phase_start) * 1000);
+        phase_start = phase.second;
+    }
+    fwprintf(stderr, L"%-20ls %8.2f ms\n", L"total", (phase_start - s_startup_time) * 1000);
+
+    double parse_seconds;
+    size_t cached, parsed;
+    reader_get_parse_timing(&parse_seconds, &cached, &parsed);
+    fwprintf(stderr, L"%-20ls %8.2f ms (%lu scripts parsed, %lu from the parse cache)\n",
+             L"of which parsing", parse_seconds * 1000, (unsigned long)parsed,
+             (unsigned long)cached);
+}
+
 static bool has_suffix(const std::string &path, const char *suffix, bool ignore_case) {
     size_t pathlen = path.size(), suffixlen = strlen(suffix);
     return pathlen >= suffixlen &&
@@ -278,7 +311,9 @@ static void check_running_fishd() {
 /// Parse init files. exec_path is the path of fish executable as determined by argv[0].
 static int read_init(const struct config_paths_t &paths) {
     source_config_in_directory(paths.data);
+    mark_startup_phase(L"share/config.fish");
     source_config_in_directory(paths.sysconf);
+    mark_startup_phase(L"etc/config.fish");
 
     // We need to get the configuration directory before we can source the user configuration file.
     // If path_get_config returns false then we have no configuration directory and no custom config
@@ -287,6 +322,7 @@ static int read_init(const struct config_paths_t &paths) {
     if (path_get_config(config_dir)) {
         source_config_in_directory(config_dir);
     }
+    mark_startup_phase(L"user config.fish");
 
     return 1;
 }
@@ -301,6 +337,7 @@ static int fish_parse_opt(int argc, char **argv, std::vector<std::string> *cmds)
                                        {"login", no_argument, NULL, 'l'},
                                        {"no-execute", no_argument, NULL, 'n'},
                                        {"profile", required_argument, NULL, 'p'},
+                                       {"print-startup-timing", no_argument, NULL, 1},
                                        {"help", no_argument, NULL, 'h'},
                                        {"version", no_argument, NULL, 'v'},
                                        {NULL, 0, NULL, 0}};
@@ -353,6 +390,10 @@ static int fish_parse_opt(int argc, char **argv, std::vector<std::string> *cmds)
                 g_profiling_active = true;
                 break;
             }
+            case 1: {
+                s_print_startup_timing = true;
+                break;
+            }
             case 'v': {
                 fwprintf(stdout, _(L"%s, version %s\n"), PACKAGE_NAME, get_fish_version());
                 exit(0);
@@ -425,6 +466,7 @@ int main(int argc, char **argv) {
     int my_optind = 0;
 
     program_name = L"fish";
+    s_startup_time = timef();
     set_main_thread();
     setup_fork_guards();
 
@@ -466,6 +508,7 @@ int main(int argc, char **argv) {
     // For set_color to support term256 in config.fish (issue #1022).
     update_fish_color_support();
     misc_init();
+    mark_startup_phase(L"initialization");
 
     parser_t &parser = parser_t::principal_parser();
 
@@ -484,10 +527,12 @@ int main(int argc, char **argv) {
                 const wcstring cmd_wcs = str2wcstring(cmds.at(i));
                 res = parser.eval(cmd_wcs, empty_ios, TOP);
             }
+            mark_startup_phase(L"commands");
             reader_exit(0, 0);
         } else if (my_optind == argc) {
             // Interactive mode
             check_running_fishd();
+            print_startup_timing();
             res = reader_read(STDIN_FILENO, empty_ios);
         } else {
             char *file = *(argv + (my_optind++));
@@ -515,6 +560,7 @@ int main(int argc, char **argv) {
                 reader_push_current_filename(rel_filename.c_str());
 
                 res = reader_read(fd, empty_ios);
+                mark_startup_phase(L"script");
 
                 if (res) {
                     debug(1, _(L"Error while reading file %ls\n"), reader_current_filename()
@@ -526,6 +572,7 @@ int main(int argc, char **argv) {
         }
     }
 
+    print_startup_timing();
     int exit_status = res ? STATUS_UNKNOWN_COMMAND : proc_get_last_status();
 
     proc_fire_event(L"PROCESS_EXIT", EVENT_EXIT, getpid(), exit_status);
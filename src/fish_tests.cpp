@@ -4,8 +4,10 @@
 // IWYU pragma: no_include <cstring>
 // IWYU pragma: no_include <cstddef>
 #include <assert.h>
+#include <fcntl.h>
 #include <libgen.h>
 #include <limits.h>
+#include <locale.h>
 #include <pthread.h>
 #include <signal.h>
 #include <stdarg.h>
@@ -15,6 +17,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/select.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
 #include <sys/utsname.h>
@@ -479,6 +482,78 @@ static void test_iothread(void) {
     delete int_ptr;
 }
 
+// Context for measuring how long requests wait in the iothread queues.
+struct iothread_latency_ctx_t {
+    double submitted;
+    double latency;
+    bool ran;
+};
+
+static int test_iothread_latency_call(iothread_latency_ctx_t *ctx) {
+    ctx->latency = timef() - ctx->submitted;
+    ctx->ran = true;
+    return 1;
+}
+
+// Keeps a worker busy, to put the queues under load.
+static int test_iothread_busy_call(void *unused) {
+    UNUSED(unused);
+    usleep(2000);
+    return 0;
+}
+
+/// Submits requests of the given priority behind a backlog of busy requests, and reports how long
+/// they waited to start.
+static double time_iothread_latency(iothread_priority_t priority, int backlog) {
+    const int request_count = 50;
+    std::vector<iothread_latency_ctx_t> ctxs(request_count);
+    for (int i = 0; i < request_count; i++) {
+        for (int j = 0; j < backlog / request_count; j++) {
+            iothread_perform_base(test_iothread_busy_call, NULL, NULL);
+        }
+        ctxs[i].submitted = timef();
+        ctxs[i].ran = false;
+        iothread_perform_base((int (*)(void *))test_iothread_latency_call, NULL, &ctxs[i],
+                              priority);
+    }
+    iothread_drain_all();
+
+    double total = 0;
+    for (int i = 0; i < request_count; i++) {
+        if (!ctxs[i].ran) err(L"iothread request %d was not performed", i);
+        total += ctxs[i].latency;
+    }
+    return total / request_count;
+}
+
+static void test_iothread_cancellation(void) {
+    say(L"Testing iothread cancellation");
+    volatile unsigned int generation = 0;
+    iothread_latency_ctx_t cancelled = {0, 0, false}, kept = {0, 0, false};
+
+    // Occupy the workers so the requests can't start before we cancel one of them.
+    for (int i = 0; i < 64; i++) iothread_perform_base(test_iothread_busy_call, NULL, NULL);
+    iothread_perform_base((int (*)(void *))test_iothread_latency_call, NULL, &cancelled,
+                          IOTHREAD_PRIORITY_NORMAL, iothread_cancel_token_t(&generation));
+    generation++;
+    iothread_perform_base((int (*)(void *))test_iothread_latency_call, NULL, &kept,
+                          IOTHREAD_PRIORITY_NORMAL, iothread_cancel_token_t(&generation));
+    iothread_drain_all();
+
+    if (cancelled.ran) err(L"Cancelled iothread request was performed");
+    if (!kept.ran) err(L"Uncancelled iothread request was not performed");
+}
+
+/// Measures how long requests wait in the queues while the workers are busy.
+static void test_iothread_latency(void) {
+    say(L"Timing iothread queue latency");
+    const int backlog = 1000;
+    double normal = time_iothread_latency(IOTHREAD_PRIORITY_NORMAL, backlog);
+    double interactive = time_iothread_latency(IOTHREAD_PRIORITY_INTERACTIVE, backlog);
+    say(L"    (with a backlog of %d requests: %.02f msec normal, %.02f msec interactive)", backlog,
+        normal * 1000.0, interactive * 1000.0);
+}
+
 static parser_test_error_bits_t detect_argument_errors(const wcstring &src) {
     parse_node_tree_t tree;
     if (!parse_tree_from_string(src, parse_flag_none, &tree, NULL, symbol_argument_list)) {
@@ -711,6 +786,53 @@ static void test_cancellation() {
     reader_reset_interrupted();
 }
 
+/// Run a job with job control and check its output and how many times fish forked for it.
+static void test_1_pipeline_forks(const wchar_t *src, const char *expected, int expected_forks) {
+    shared_ptr<io_buffer_t> out_buff(io_buffer_t::create(STDOUT_FILENO, io_chain_t()));
+    const io_chain_t io_chain(out_buff);
+    const int fork_count = g_fork_count;
+    parser_t::principal_parser().eval(src, io_chain, TOP);
+    out_buff->read();
+    const std::string out(out_buff->out_buffer_ptr(), out_buff->out_buffer_size());
+    if (out != expected) {
+        err(L"'%ls' printed '%s' instead of '%s'", src, out.c_str(), expected);
+    }
+    if (g_fork_count - fork_count != expected_forks) {
+        err(L"'%ls' forked %d times instead of %d", src, g_fork_count - fork_count,
+            expected_forks);
+    }
+}
+
+static void test_pipeline_forks() {
+    say(L"Testing forks for pipelines");
+
+    // Put jobs in their own process groups, but don't try to give them the terminal.
+    const int saved_job_control_mode = job_control_mode;
+    const int saved_is_subshell = is_subshell;
+    job_control_mode = JOB_CONTROL_ALL;
+    is_subshell = 1;
+    // Reaping children relies on the SIGCHLD handler.
+    signal_set_handlers();
+
+    parser_t::principal_parser().eval(
+        L"function pipeline_forks_func; cat; command true; end", io_chain_t(), TOP);
+
+    test_1_pipeline_forks(L"command echo x | cat", "x\n", 2);
+    test_1_pipeline_forks(L"echo x | cat", "x\n", 1);
+    // The group leader exits while the first function runs and reaps jobs of its own, but the rest
+    // of the pipeline can still join its group.
+    test_1_pipeline_forks(
+        L"command echo x | pipeline_forks_func | pipeline_forks_func | cat", "x\n", 6);
+    // Output that doesn't fit in the pipe is written by a thread while the next process reads it.
+    test_1_pipeline_forks(L"printf '%0200000d' 0 | string length", "200000\n", 0);
+    test_1_pipeline_forks(L"printf '%0200000d' 0 2>&1 | cat | string length", "200000\n", 1);
+
+    parser_t::principal_parser().eval(L"functions -e pipeline_forks_func", io_chain_t(), TOP);
+    signal_reset_handlers();
+    job_control_mode = saved_job_control_mode;
+    is_subshell = saved_is_subshell;
+}
+
 static void test_indents() {
     say(L"Testing indents");
 
@@ -1423,7 +1545,24 @@ static void test_abbreviations(void) {
     expanded = reader_expand_abbreviation_in_command(L"command gc", wcslen(L"command gc"), &result);
     if (expanded) err(L"gc incorrectly expanded on line %ld", (long)__LINE__);
 
+    // Changing the variable changes the abbreviations.
+    env_set(USER_ABBREVIATIONS_VARIABLE_NAME, L"gc=git commit", ENV_LOCAL);
+    if (!expand_abbreviation(L"gc", &result) || result != L"git commit")
+        err(L"Abbreviations not updated on line %ld", (long)__LINE__);
+    if (expand_abbreviation(L"gx", &result))
+        err(L"Stale abbreviation expanded on line %ld", (long)__LINE__);
+
+    // So does hiding it in a new scope, and leaving the scope.
+    env_push(true);
+    if (expand_abbreviation(L"gc", &result))
+        err(L"Hidden abbreviation expanded on line %ld", (long)__LINE__);
     env_pop();
+    if (!expand_abbreviation(L"gc", &result))
+        err(L"Abbreviation not restored on line %ld", (long)__LINE__);
+
+    env_pop();
+    if (expand_abbreviation(L"gc", &result))
+        err(L"Abbreviation expanded after its scope ended on line %ld", (long)__LINE__);
 }
 
 /// Test path functions.
@@ -2389,6 +2528,94 @@ static void test_universal_callbacks() {
     if (system("rm -Rf /tmp/fish_uvars_test")) err(L"rm failed");
 }
 
+/// Returns the number of lines in the file at the given path.
+static size_t count_lines_in_file(const char *path) {
+    size_t count = 0;
+    FILE *f = fopen(path, "r");
+    if (f != NULL) {
+        int c;
+        while ((c = fgetc(f)) != EOF) {
+            if (c == '\n') count++;
+        }
+        fclose(f);
+    }
+    return count;
+}
+
+static void test_universal_log() {
+    say(L"Testing universal variable log");
+    if (system("mkdir -p /tmp/fish_uvars_test/")) err(L"mkdir failed");
+    const char *narrow_path = "/tmp/fish_uvars_test/varsfile.txt";
+    env_universal_t uvars1(UVARS_TEST_PATH);
+    env_universal_t uvars2(UVARS_TEST_PATH);
+
+    uvars1.set(L"alpha", L"1", false);
+    uvars1.set(L"beta", L"1", false);
+    uvars1.sync(NULL);
+    uvars2.sync(NULL);
+
+    // Changes are appended to the file, and the other instance applies just those.
+    size_t lines_before = count_lines_in_file(narrow_path);
+    uvars1.set(L"alpha", L"2", true);
+    uvars1.sync(NULL);
+    do_test(count_lines_in_file(narrow_path) == lines_before + 1);
+
+    callback_data_list_t callbacks;
+    uvars2.sync(&callbacks);
+    do_test(callbacks.size() == 1);
+    do_test(callbacks.at(0).type == SET_EXPORT);
+    do_test(callbacks.at(0).key == L"alpha");
+    do_test(callbacks.at(0).val == L"2");
+
+    // Erasing a variable rewrites the file without it, instead of appending a record that older
+    // versions of fish would not understand.
+    uvars1.remove(L"beta");
+    uvars1.sync(NULL);
+    do_test(count_lines_in_file(narrow_path) == lines_before - 1);
+
+    callbacks.clear();
+    uvars2.sync(&callbacks);
+    do_test(callbacks.size() == 1);
+    do_test(callbacks.at(0).type == ERASE);
+    do_test(callbacks.at(0).key == L"beta");
+    do_test(uvars2.get(L"beta").missing());
+
+    // Many changes to the same variable eventually cause the file to be compacted.
+    for (int i = 0; i < 200; i++) {
+        uvars1.set(L"gamma", to_string(i), false);
+        uvars1.sync(NULL);
+    }
+    do_test(count_lines_in_file(narrow_path) < 100);
+
+    callbacks.clear();
+    uvars2.sync(&callbacks);
+    do_test(callbacks.size() == 1);
+    do_test(uvars2.get(L"gamma") == L"199");
+    do_test(uvars2.get(L"alpha") == L"2");
+
+    // A fresh instance reads the same variables, decoding them as they are used.
+    wcstring escaped_val = L"caf\u00e9 \\";
+    escaped_val.push_back(ARRAY_SEP);
+    escaped_val.append(L"two:words");
+    uvars1.set(L"delta", escaped_val, false);
+    uvars1.sync(NULL);
+    env_universal_t uvars3(UVARS_TEST_PATH);
+    uvars3.load();
+    do_test(uvars3.get(L"delta") == escaped_val);
+    do_test(uvars3.get(L"gamma") == L"199");
+    do_test(uvars3.get(L"alpha") == L"2");
+    do_test(uvars3.get_export(L"alpha"));
+    do_test(uvars3.get(L"beta").missing());
+
+    // Values that haven't been decoded yet don't depend on the file, which may be truncated.
+    env_universal_t uvars4(UVARS_TEST_PATH);
+    uvars4.load();
+    if (truncate(narrow_path, 0)) err(L"truncate failed");
+    do_test(uvars4.get(L"delta") == escaped_val);
+
+    if (system("rm -Rf /tmp/fish_uvars_test")) err(L"rm failed");
+}
+
 bool poll_notifier(universal_notifier_t *note) {
     bool result = false;
     if (note->usec_delay_between_polls() > 0) {
@@ -2428,6 +2655,11 @@ static void trigger_or_wait_for_notification(universal_notifier_t *notifier,
             usleep(1000000 / 25);
             break;
         }
+        case universal_notifier_t::strategy_inotify: {
+            // Writing to the variables file is the notification.
+            if (system("echo >> /tmp/fish_uvars_test/varsfile.txt")) err(L"echo failed");
+            break;
+        }
         case universal_notifier_t::strategy_named_pipe:
         case universal_notifier_t::strategy_null: {
             break;
@@ -2502,6 +2734,46 @@ static void test_notifiers_with_strategy(universal_notifier_t::notifier_strategy
     }
 }
 
+/// Verify that the inotify notifier notices the variables file being replaced, but ignores other
+/// files in its directory.
+static void test_inotify_notifier() {
+    say(L"Testing inotify notifier with other files");
+    universal_notifier_t *notifier = universal_notifier_t::new_notifier_for_strategy(
+        universal_notifier_t::strategy_inotify, UVARS_TEST_PATH);
+
+    if (system("echo >> /tmp/fish_uvars_test/otherfile.txt")) err(L"echo failed");
+    if (poll_notifier(notifier)) {
+        err(L"inotify notifier noticed a change to another file");
+    }
+
+    if (system("echo >> /tmp/fish_uvars_test/newvars.txt && "
+               "mv /tmp/fish_uvars_test/newvars.txt /tmp/fish_uvars_test/varsfile.txt")) {
+        err(L"mv failed");
+    }
+    if (!poll_notifier(notifier)) {
+        err(L"inotify notifier failed to notice the variables file being replaced");
+    }
+    if (poll_notifier(notifier)) {
+        err(L"inotify notifier polled true again without changes");
+    }
+
+    // Shells using the named pipe see the notifications too.
+    universal_notifier_t *pipe_notifier = universal_notifier_t::new_notifier_for_strategy(
+        universal_notifier_t::strategy_named_pipe, UVARS_TEST_PATH);
+    notifier->post_notification();
+    if (!poll_notifier(pipe_notifier)) {
+        err(L"named pipe notifier failed to notice a notification from the inotify notifier");
+    }
+    usleep(1000000 / 10);  // corresponds to NAMED_PIPE_FLASH_DURATION_USEC
+    poll_notifier(notifier);
+    poll_notifier(pipe_notifier);
+    if (poll_notifier(pipe_notifier)) {
+        err(L"named pipe notifier polled true after the inotify notifier cleaned up");
+    }
+    delete pipe_notifier;
+    delete notifier;
+}
+
 static void test_universal_notifiers() {
     if (system("mkdir -p /tmp/fish_uvars_test/ && touch /tmp/fish_uvars_test/varsfile.txt"))
         err(L"mkdir failed");
@@ -2510,6 +2782,10 @@ static void test_universal_notifiers() {
 #if __APPLE__
     test_notifiers_with_strategy(universal_notifier_t::strategy_notifyd);
 #endif
+#if __linux__
+    test_notifiers_with_strategy(universal_notifier_t::strategy_inotify);
+    test_inotify_notifier();
+#endif
 
     if (system("rm -Rf /tmp/fish_uvars_test/")) err(L"rm failed");
 }
@@ -2518,6 +2794,7 @@ class history_tests_t {
    public:
     static void test_history(void);
     static void test_history_merge(void);
+    static void test_history_index(void);
     static void test_history_formats(void);
     // static void test_history_speed(void);
     static void test_history_races(void);
@@ -2899,6 +3176,123 @@ static bool history_equals(history_t &hist, const wchar_t *const *strings) {
     return true;
 }
 
+/// Returns whether the LC_CTYPE locale encodes characters as UTF-8.
+static bool ctype_is_utf8() {
+    char buf[MB_LEN_MAX];
+    mbstate_t state = {};
+    return wcrtomb(buf, L'\u00C9', &state) == 2 && !memcmp(buf, "\xC3\x89", 2);
+}
+
+void history_tests_t::test_history_index(void) {
+    say(L"Testing history index");
+    const wcstring name = L"index_test";
+
+    // Case insensitive matching of non-ASCII characters needs a UTF-8 locale, which make test does
+    // not set. Switch to one if we can, and skip those checks if we can't.
+    const std::string saved_ctype = setlocale(LC_CTYPE, NULL);
+    const char *const utf8_locales[] = {"C.UTF-8", "en_US.UTF-8", "C.utf8", "en_US.utf8", NULL};
+    bool have_utf8 = ctype_is_utf8();
+    for (size_t i = 0; !have_utf8 && utf8_locales[i] != NULL; i++) {
+        have_utf8 = setlocale(LC_CTYPE, utf8_locales[i]) != NULL && ctype_is_utf8();
+    }
+    if (!have_utf8) {
+        setlocale(LC_CTYPE, saved_ctype.c_str());
+        say(L"Skipping non-ASCII history index checks: no UTF-8 locale");
+    }
+
+    history_t *writer = new history_t(name);
+    writer->clear();
+    time_barrier();
+
+    // Write the first half in one go, which creates the index, and the second half one item at a
+    // time, which appends to it.
+    writer->disable_automatic_saving();
+    writer->add(L"echo backslash\\n");
+    writer->add(L"echo multi\nline");
+    if (have_utf8) writer->add(L"echo \u00C9COLE");
+    for (int i = 1; i <= 50; i++) {
+        writer->add(format_string(L"echo Item %d", i));
+    }
+    writer->enable_automatic_saving();
+    for (int i = 51; i <= 100; i++) {
+        writer->add(format_string(L"echo Item %d", i));
+        writer->save();
+    }
+
+    wcstring index_path;
+    do_test(path_get_data(index_path));
+    index_path.append(L"/" + name + L"_history.index");
+    struct stat buf;
+    do_test(wstat(index_path, &buf) == 0 && buf.st_size > 0);
+
+    // Searches in a new history must find exactly the same items with or without a usable index,
+    // and must not use an index that no longer describes the history file.
+    for (int pass = 0; pass < 3; pass++) {
+        if (pass == 1) {
+            // Rewrite an item in place, keeping the length and modification time of the file.
+            wcstring history_path;
+            do_test(path_get_data(history_path));
+            history_path.append(L"/" + name + L"_history");
+            int fd = wopen_cloexec(history_path, O_RDWR);
+            do_test(fd >= 0);
+            if (fd >= 0) {
+                const file_id_t file_id = file_id_for_fd(fd);
+                std::string contents(file_id.size, '\0');
+                do_test(read_loop(fd, &contents.at(0), contents.size()) ==
+                        (ssize_t)contents.size());
+                size_t where = contents.find("echo Item 99\n");
+                do_test(where != std::string::npos);
+                do_test(pwrite(fd, "echo Izqx 99", 12, where) == 12);
+                struct timespec times[2];
+                times[0].tv_sec = 0;
+                times[0].tv_nsec = UTIME_OMIT;
+                times[1].tv_sec = file_id.mod_seconds;
+                times[1].tv_nsec = file_id.mod_nanoseconds;
+                do_test(futimens(fd, times) == 0);
+                close(fd);
+            }
+        }
+        if (pass == 2) {
+            int fd = wopen_cloexec(index_path, O_WRONLY | O_TRUNC);
+            do_test(fd >= 0 && write_loop(fd, "garbage", 7) == 7);
+            if (fd >= 0) close(fd);
+        }
+        time_barrier();
+        history_t *reader = new history_t(name);
+        history_search_t searcher(*reader, L"Item 1");
+        test_history_matches(searcher, 12, __LINE__);
+        do_test(searcher.current_string() == L"echo Item 100");
+        searcher = history_search_t(*reader, L"ECHO ITEM 5", HISTORY_SEARCH_TYPE_PREFIX, false);
+        test_history_matches(searcher, 11, __LINE__);
+        searcher = history_search_t(*reader, L"echo Item 77", HISTORY_SEARCH_TYPE_EXACT, true);
+        test_history_matches(searcher, 1, __LINE__);
+        searcher = history_search_t(*reader, L"item 7", HISTORY_SEARCH_TYPE_CONTAINS, true);
+        test_history_matches(searcher, 0, __LINE__);
+        searcher = history_search_t(*reader, L"zqx");
+        test_history_matches(searcher, pass == 0 ? 0 : 1, __LINE__);
+
+        // Escaped characters must be matched as what they stand for.
+        searcher = history_search_t(*reader, L"h\\n");
+        test_history_matches(searcher, 1, __LINE__);
+        do_test(searcher.current_string() == L"echo backslash\\n");
+        searcher = history_search_t(*reader, L"i\nl");
+        test_history_matches(searcher, 1, __LINE__);
+        do_test(searcher.current_string() == L"echo multi\nline");
+
+        // Non-ASCII characters must be matched case insensitively.
+        if (have_utf8) {
+            searcher =
+                history_search_t(*reader, L"\u00E9cole", HISTORY_SEARCH_TYPE_CONTAINS, false);
+            test_history_matches(searcher, 1, __LINE__);
+        }
+        delete reader;
+    }
+
+    writer->clear();
+    delete writer;
+    setlocale(LC_CTYPE, saved_ctype.c_str());
+}
+
 void history_tests_t::test_history_formats(void) {
     const wchar_t *name;
 
@@ -3569,6 +3963,84 @@ static void test_highlighting(void) {
     }
 }
 
+static void test_incremental_highlighting(void) {
+    say(L"Testing incremental syntax highlighting");
+    if (system("mkdir -p /tmp/fish_highlight_test/")) err(L"mkdir failed");
+    if (system("touch /tmp/fish_highlight_test/foo")) err(L"touch failed");
+
+    // A series of edits of a command line, each highlighted starting from the one before it, with
+    // the position of the cursor.
+    const struct {
+        const wchar_t *txt;
+        size_t cursor;
+    } edits[] = {
+        {L"echo hello\nif true\n  ls /tmp\nend\ncd /tmp/fish_highlight_test\n"
+         L"echo (echo sub) > /tmp/fish_highlight_test/out",
+         0},
+        {L"echo hello world\nif true\n  ls /tmp\nend\ncd /tmp/fish_highlight_test\n"
+         L"echo (echo sub) > /tmp/fish_highlight_test/out",
+         16},
+        {L"echo hello world\nif true\n  ls /tmp\nend\ncd /tmp/fish_highlight_test/nope\n"
+         L"echo (echo sub) > /tmp/fish_highlight_test/out",
+         70},
+        {L"echo hello world\nif true\n  ls /tmp\nend\ncd /tmp/fish_highlight_test/nope\n"
+         L"echo (ech sub) > /tmp/fish_highlight_test/out",
+         76},
+        {L"echo 'hello world\nif true\n  ls /tmp\nend\ncd /tmp/fish_highlight_test/nope\n"
+         L"echo (ech sub) > /tmp/fish_highlight_test/out",
+         6},
+        {L"echo hello world\nif true\n  ls /tmp\nend\ncd /tmp/fish_highlight_test/nope\n"
+         L"echo (ech sub) > /tmp/fish_highlight_test/out",
+         5},
+        {L"echo hello world\nif true\n  ls /tmp/fish_highlight_test/foo\nend\n"
+         L"cd /tmp/fish_highlight_test/nope\necho (ech sub) > /tmp/fish_highlight_test/out",
+         50},
+        {L"echo hello world\nif true\n  ls /tmp/fish_highlight_test/foo\nend\n"
+         L"cd /tmp/fish_highlight_test/nope\necho (ech sub) > /tmp/fish_highlight_test/out",
+         0},
+        {L"ech hello world\nif true\n  ls /tmp/fish_highlight_test/foo\nend\n"
+         L"cd /tmp/fish_highlight_test/nope\necho (ech sub) > /tmp/fish_highlight_test/out",
+         3}};
+
+    highlight_cache_clear();
+    const env_vars_snapshot_t &vars = env_vars_snapshot_t::current();
+    for (size_t which = 0; which < sizeof edits / sizeof *edits; which++) {
+        const wcstring text = edits[which].txt;
+        std::vector<highlight_spec_t> colors, expected_colors;
+        highlight_shell(text, colors, edits[which].cursor, NULL, vars);
+
+        // Compare against highlighting the command line from scratch.
+        highlight_shell(L"#", expected_colors, 0, NULL, vars);
+        highlight_shell(text, expected_colors, edits[which].cursor, NULL, vars);
+        do_test(expected_colors.size() == colors.size());
+        for (size_t i = 0; i < text.size() && i < colors.size(); i++) {
+            if (expected_colors.at(i) != colors.at(i)) {
+                const wcstring spaces(i, L' ');
+                err(L"Wrong color at index %lu in edit %lu (expected %#x, actual %#x):\n%ls\n%ls^",
+                    i, which, expected_colors.at(i), colors.at(i), text.c_str(), spaces.c_str());
+                break;
+            }
+        }
+
+        // Start the next edit from this one.
+        highlight_shell(text, colors, edits[which].cursor, NULL, vars);
+    }
+
+    // Checks are cached, but clearing the cache picks up changes.
+    const wcstring cd_text = L"cd /tmp/fish_highlight_test/newdir";
+    std::vector<highlight_spec_t> colors;
+    highlight_shell(cd_text, colors, 0, NULL, vars);
+    do_test(!colors.empty() && highlight_get_primary(colors.back()) == highlight_spec_error);
+    if (system("mkdir -p /tmp/fish_highlight_test/newdir")) err(L"mkdir failed");
+    highlight_cache_clear();
+    highlight_shell(cd_text, colors, 0, NULL, vars);
+    do_test(!colors.empty() && highlight_get_primary(colors.back()) == highlight_spec_param);
+
+    if (system("rm -Rf /tmp/fish_highlight_test")) {
+        err(L"rm failed");
+    }
+}
+
 static void test_wcstring_tok(void) {
     say(L"Testing wcstring_tok");
     wcstring buff = L"hello world";
@@ -3909,9 +4381,117 @@ static void test_timezone_env_vars(void) {
     }
 }
 
+/// Verify that values returned by env_get_string share their elements with the variable, and are
+/// not changed by later modifications of it.
+static void test_shared_env_values(void) {
+    wcstring_list_t vals;
+    vals.push_back(L"a");
+    vals.push_back(L"b");
+    env_push(true);
+    env_set(L"SHARED_TEST_VAR", vals, ENV_LOCAL);
+
+    env_var_t first = env_get_string(L"SHARED_TEST_VAR");
+    env_var_t second = env_get_string(L"SHARED_TEST_VAR");
+    if (&first.as_list() != &second.as_list()) {
+        err(L"Values of the same variable do not share their elements");
+    }
+
+    wcstring_list_t more;
+    more.push_back(L"c");
+    env_set(L"SHARED_TEST_VAR", more, ENV_LOCAL | ENV_APPEND);
+    if (first.as_list().size() != 2 || first.as_string() != L"a" ARRAY_SEP_STR L"b") {
+        err(L"Appending to a variable changed a value returned before");
+    }
+    env_var_t third = env_get_string(L"SHARED_TEST_VAR");
+    if (third.as_list().size() != 3 || third.as_list().back() != L"c") {
+        err(L"Appending to a shared variable did not append");
+    }
+    env_pop();
+}
+
+/// Verify that variables in outer scopes are shadowed by inner ones, and hidden by new scopes.
+static void test_env_scopes(void) {
+    env_set(L"SCOPE_TEST_VAR", L"global", ENV_GLOBAL);
+    env_push(false);
+    env_set(L"SCOPE_TEST_VAR", L"outer", ENV_LOCAL);
+    env_push(false);
+    if (env_get_string(L"SCOPE_TEST_VAR") != L"outer") {
+        err(L"Variable in an enclosing block is not visible");
+    }
+    env_set(L"SCOPE_TEST_VAR", L"inner", ENV_LOCAL);
+    if (env_get_string(L"SCOPE_TEST_VAR") != L"inner") {
+        err(L"Variable in the innermost block does not shadow the enclosing one");
+    }
+
+    env_push(true);
+    if (env_get_string(L"SCOPE_TEST_VAR") != L"global") {
+        err(L"Variable in a function's caller is visible in the function");
+    }
+    if (!env_exist(L"SCOPE_TEST_VAR", ENV_DEFAULT) || env_exist(L"SCOPE_TEST_VAR", ENV_LOCAL)) {
+        err(L"Only the global variable should exist in a new scope");
+    }
+    env_pop();
+
+    env_pop();
+    if (env_get_string(L"SCOPE_TEST_VAR") != L"outer") {
+        err(L"Popping a block did not reveal the variable it shadowed");
+    }
+    env_remove(L"SCOPE_TEST_VAR", ENV_LOCAL);
+    if (env_get_string(L"SCOPE_TEST_VAR") != L"global") {
+        err(L"Removing a local variable did not reveal the global one");
+    }
+    env_pop();
+    env_remove(L"SCOPE_TEST_VAR", ENV_GLOBAL);
+    if (!env_get_string(L"SCOPE_TEST_VAR").missing()) {
+        err(L"Removed variable is still visible");
+    }
+}
+
+/// Returns the value of the given variable in the environment of child processes, or NULL.
+static const char *exported_value(const char *name) {
+    size_t len = strlen(name);
+    for (const char *const *env = env_export_arr(false); *env != NULL; env++) {
+        if (strncmp(*env, name, len) == 0 && (*env)[len] == '=') return *env + len + 1;
+    }
+    return NULL;
+}
+
+/// Verify that the environment of child processes follows changes to exported variables.
+static void test_env_export(void) {
+    env_set(L"EXPORT_TEST_VAR", L"global", ENV_GLOBAL | ENV_EXPORT);
+    const char *val = exported_value("EXPORT_TEST_VAR");
+    if (val == NULL || strcmp(val, "global") != 0) {
+        err(L"Exported global variable is missing from the environment");
+    }
+
+    env_push(false);
+    env_set(L"EXPORT_TEST_VAR", L"hidden", ENV_LOCAL | ENV_UNEXPORT);
+    if (exported_value("EXPORT_TEST_VAR") != NULL) {
+        err(L"Unexported local variable does not hide the exported global one");
+    }
+    env_set(L"EXPORT_TEST_VAR", L"local", ENV_LOCAL | ENV_EXPORT);
+    val = exported_value("EXPORT_TEST_VAR");
+    if (val == NULL || strcmp(val, "local") != 0) {
+        err(L"Exported local variable is missing from the environment");
+    }
+    env_pop();
+
+    val = exported_value("EXPORT_TEST_VAR");
+    if (val == NULL || strcmp(val, "global") != 0) {
+        err(L"Popping a block did not restore the exported global variable");
+    }
+    env_remove(L"EXPORT_TEST_VAR", ENV_GLOBAL);
+    if (exported_value("EXPORT_TEST_VAR") != NULL) {
+        err(L"Removed variable is still exported");
+    }
+}
+
 /// Verify that setting special env vars have the expected effect on the current shell process.
 static void test_env_vars(void) {
     test_timezone_env_vars();
+    test_shared_env_values();
+    test_env_scopes();
+    test_env_export();
     // TODO: Add tests for the locale and ncurses vars.
 }
 
@@ -3960,6 +4540,7 @@ int main(int argc, char **argv) {
     signal_reset_handlers();
 
     if (should_test_function("highlighting")) test_highlighting();
+    if (should_test_function("incremental_highlighting")) test_incremental_highlighting();
     if (should_test_function("new_parser_ll2")) test_new_parser_ll2();
     if (should_test_function("new_parser_fuzzing"))
         test_new_parser_fuzzing();  // fuzzing is expensive
@@ -3974,8 +4555,11 @@ int main(int argc, char **argv) {
     if (should_test_function("convert_nulls")) test_convert_nulls();
     if (should_test_function("tok")) test_tokenizer();
     if (should_test_function("iothread")) test_iothread();
+    if (should_test_function("iothread")) test_iothread_cancellation();
+    if (should_test_function("iothread")) test_iothread_latency();
     if (should_test_function("parser")) test_parser();
     if (should_test_function("cancellation")) test_cancellation();
+    if (should_test_function("pipeline_forks")) test_pipeline_forks();
     if (should_test_function("indents")) test_indents();
     if (should_test_function("utils")) test_utils();
     if (should_test_function("utf8")) test_utf8();
@@ -3994,6 +4578,7 @@ int main(int argc, char **argv) {
     if (should_test_function("input")) test_input();
     if (should_test_function("universal")) test_universal();
     if (should_test_function("universal")) test_universal_callbacks();
+    if (should_test_function("universal")) test_universal_log();
     if (should_test_function("notifiers")) test_universal_notifiers();
     if (should_test_function("completion_insertions")) test_completion_insertions();
     if (should_test_function("autosuggestion_ignores")) test_autosuggestion_ignores();
@@ -4002,6 +4587,7 @@ int main(int argc, char **argv) {
     if (should_test_function("wcstring_tok")) test_wcstring_tok();
     if (should_test_function("history")) history_tests_t::test_history();
     if (should_test_function("history_merge")) history_tests_t::test_history_merge();
+    if (should_test_function("history_index")) history_tests_t::test_history_index();
     if (should_test_function("history_races")) history_tests_t::test_history_races();
     if (should_test_function("history_formats")) history_tests_t::test_history_formats();
     if (should_test_function("string")) test_string();
@@ -23,6 +23,7 @@
 #include "fallback.h"  // IWYU pragma: keep
 #include "function.h"
 #include "intern.h"
+#include "parse_tree.h"
 #include "parser_keywords.h"
 #include "reader.h"
 #include "wutil.h"  // IWYU pragma: keep
@@ -155,7 +156,8 @@ function_info_t::function_info_t(const function_info_t &data, const wchar_t *fil
       named_arguments(data.named_arguments),
       inherit_vars(data.inherit_vars),
       is_autoload(autoload),
-      shadow_scope(data.shadow_scope) {}
+      shadow_scope(data.shadow_scope),
+      parsed_definition(data.parsed_definition) {}
 
 void function_add(const function_data_t &data, const parser_t &parser, int definition_line_offset) {
     UNUSED(parser);
@@ -247,6 +249,24 @@ bool function_get_definition(const wcstring &name, wcstring *out_definition) {
     return func != NULL;
 }
 
+bool function_get_parsed_definition(const wcstring &name, wcstring *out_definition,
+                                    parsed_tree_ref_t *out_tree) {
+    scoped_lock locker(functions_lock);
+    function_map_t::iterator iter = loaded_functions.find(name);
+    if (iter == loaded_functions.end()) return false;
+
+    function_info_t &func = iter->second;
+    if (!func.parsed_definition) {
+        parse_node_tree_t tree;
+        if (parse_tree_from_string(func.definition, parse_flag_none, &tree, NULL)) {
+            func.parsed_definition.reset(new parse_node_tree_t(moved_ref<parse_node_tree_t>(tree)));
+        }
+    }
+    if (out_definition) out_definition->assign(func.definition);
+    if (out_tree) *out_tree = func.parsed_definition;
+    return true;
+}
+
 wcstring_list_t function_get_named_arguments(const wcstring &name) {
     scoped_lock locker(functions_lock);
     const function_info_t *func = function_get(name);
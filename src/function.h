@@ -10,6 +10,7 @@
 #include "common.h"
 #include "env.h"
 #include "event.h"
+#include "parse_tree.h"
 
 class parser_t;
 
@@ -53,6 +54,9 @@ class function_info_t {
     const bool is_autoload;
     /// Set to true if invoking this function shadows the variables of the underlying function.
     const bool shadow_scope;
+    /// Parse tree of the definition. This is populated lazily on the first call and shared by all
+    /// later calls. Redefining the function replaces the function_info_t, discarding the tree.
+    parsed_tree_ref_t parsed_definition;
 
     /// Constructs relevant information from the function_data.
     function_info_t(const function_data_t &data, const wchar_t *filename, int def_offset,
@@ -78,6 +82,12 @@ void function_remove(const wcstring &name);
 /// successful, false if no function with the given name exists.
 bool function_get_definition(const wcstring &name, wcstring *out_definition);
 
+/// Like function_get_definition, but also returns by reference the parse tree of the definition.
+/// The tree is parsed on first use and cached until the function is redefined or removed. The tree
+/// is NULL if the definition could not be parsed.
+bool function_get_parsed_definition(const wcstring &name, wcstring *out_definition,
+                                    parsed_tree_ref_t *out_tree);
+
 /// Returns by reference the description of the function with the name \c name. Returns true if the
 /// function exists and has a nonempty description, false if it does not.
 bool function_get_desc(const wcstring &name, wcstring *out_desc);
@@ -362,7 +362,7 @@ bool autosuggest_validate_from_history(const history_item_t &item,
 
     // Not handled specially so handle it here.
     bool cmd_ok = false;
-    if (path_get_path(parsed_command, NULL)) {
+    if (path_get_path_cached(parsed_command, NULL, vars)) {
         cmd_ok = true;
     } else if (builtin_exists(parsed_command) ||
                function_exists_no_autoload(parsed_command, vars)) {
@@ -647,6 +647,122 @@ static void color_argument_internal(const wcstring &buffstr,
     }
 }
 
+/// How long, in seconds, the results of checks that need I/O are reused. Highlighting runs on every
+/// keystroke, so this saves re-checking every token of a long command line, while still noticing
+/// files and commands that come and go.
+#define HIGHLIGHT_CACHE_LIFETIME 1.0
+
+/// The validity cache is flushed when it grows past this many entries.
+#define HIGHLIGHT_CACHE_MAX_ENTRIES 4096
+
+/// The checks whose results are kept in the validity cache.
+enum highlight_check_t {
+    highlight_check_command,
+    highlight_check_cd_path,
+    highlight_check_potential_path,
+    highlight_check_redirection
+};
+
+/// A cached validity check, with the time it was made.
+struct highlight_check_result_t {
+    bool valid;
+    double when;
+
+    highlight_check_result_t() : valid(false), when(0) {}
+};
+
+static pthread_mutex_t validity_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static std::map<wcstring, highlight_check_result_t> validity_cache;
+
+/// Returns the validity cache key for a check of a token in the given working directory. \p variant
+/// distinguishes checks of the same token that can come out differently, like commands with
+/// different decorations.
+static wcstring validity_cache_key(highlight_check_t check, int variant, const wcstring &token,
+                                   const wcstring &working_directory) {
+    wcstring key = format_string(L"%d.%d:", (int)check, variant);
+    key.append(working_directory);
+    key.push_back(L'\0');
+    key.append(token);
+    return key;
+}
+
+/// Looks up a check in the validity cache. Returns false if it is not there or has expired.
+static bool validity_cache_get(const wcstring &key, bool *out_valid) {
+    scoped_lock locker(validity_cache_lock);
+    std::map<wcstring, highlight_check_result_t>::const_iterator iter = validity_cache.find(key);
+    if (iter == validity_cache.end() || timef() - iter->second.when >= HIGHLIGHT_CACHE_LIFETIME) {
+        return false;
+    }
+    *out_valid = iter->second.valid;
+    return true;
+}
+
+/// Stores the result of a check in the validity cache.
+static void validity_cache_set(const wcstring &key, bool valid) {
+    scoped_lock locker(validity_cache_lock);
+    if (validity_cache.size() >= HIGHLIGHT_CACHE_MAX_ENTRIES) validity_cache.clear();
+    highlight_check_result_t &result = validity_cache[key];
+    result.valid = valid;
+    result.when = timef();
+}
+
+/// A top level job of a highlighted command line.
+struct highlight_job_t {
+    /// The source range of the job.
+    size_t start;
+    size_t length;
+    /// When the colors of the job were computed.
+    double when;
+    /// Whether the cursor was in or next to the job, so that its colors depend on the cursor.
+    bool has_cursor;
+
+    highlight_job_t(size_t s, size_t l) : start(s), length(l), when(0), has_cursor(false) {}
+
+    size_t end() const { return start + length; }
+
+    bool operator<(const highlight_job_t &other) const { return start < other.start; }
+};
+
+/// The result of highlighting a command line, kept so that highlighting it again after an edit can
+/// reuse the colors of the jobs the edit did not touch.
+struct highlight_record_t {
+    /// The command line.
+    wcstring buff;
+    /// The working directory it was highlighted in.
+    wcstring working_directory;
+    /// The resulting colors.
+    std::vector<highlight_spec_t> colors;
+    /// The top level jobs, in the order they appear.
+    std::vector<highlight_job_t> jobs;
+    /// Whether the colors can be reused. They can't if the command line did not parse, because an
+    /// error can change how everything around it is colored.
+    bool reusable;
+
+    highlight_record_t() : reusable(false) {}
+
+    void swap(highlight_record_t &other) {
+        buff.swap(other.buff);
+        working_directory.swap(other.working_directory);
+        colors.swap(other.colors);
+        jobs.swap(other.jobs);
+        std::swap(reusable, other.reusable);
+    }
+};
+
+/// The last command line highlighted by highlight_shell.
+static pthread_mutex_t last_highlight_lock = PTHREAD_MUTEX_INITIALIZER;
+static highlight_record_t last_highlight;
+
+void highlight_cache_clear() {
+    {
+        scoped_lock locker(validity_cache_lock);
+        validity_cache.clear();
+    }
+    scoped_lock locker(last_highlight_lock);
+    highlight_record_t empty;
+    last_highlight.swap(empty);
+}
+
 /// Syntax highlighter helper.
 class highlighter_t {
     // The string we're highlighting. Note this is a reference memmber variable (to avoid copying)!
@@ -665,6 +781,10 @@ class highlighter_t {
     color_array_t color_array;
     // The parse tree of the buff.
     parse_node_tree_t parse_tree;
+    // Whether the buff failed to parse.
+    bool parse_errored;
+    // Return the top level jobs of the parse tree, sorted by position.
+    std::vector<highlight_job_t> top_level_jobs() const;
     // Color an argument.
     void color_argument(const parse_node_t &node);
     // Color a redirection.
@@ -688,16 +808,41 @@ class highlighter_t {
           vars(ev),
           io_ok(can_do_io),
           working_directory(wd),
-          color_array(str.size()) {
+          color_array(str.size()),
+          parse_errored(false) {
         // Parse the tree.
+        parse_error_list_t errors;
         parse_tree_from_string(buff, parse_flag_continue_after_error | parse_flag_include_comments,
-                               &this->parse_tree, NULL);
+                               &this->parse_tree, &errors);
+        parse_errored = !errors.empty();
     }
 
-    // Perform highlighting, returning an array of colors.
-    const color_array_t &highlight();
+    // Perform highlighting, returning an array of colors. If previous is given, the colors of jobs
+    // that are unchanged from it are reused rather than recomputed. If record is given, it is
+    // filled in so it can be passed as previous next time.
+    const color_array_t &highlight(const highlight_record_t *previous = NULL,
+                                   highlight_record_t *record = NULL);
 };
 
+std::vector<highlight_job_t> highlighter_t::top_level_jobs() const {
+    std::vector<highlight_job_t> result;
+    for (node_offset_t idx = 0; idx < parse_tree.size(); idx++) {
+        const parse_node_t &node = parse_tree.at(idx);
+        if (node.type != symbol_job || !node.has_source()) continue;
+
+        // A job is at the top level if it is only nested in job lists.
+        const parse_node_t *parent = parse_tree.get_parent(node);
+        while (parent != NULL && parent->type == symbol_job_list) {
+            parent = parse_tree.get_parent(*parent);
+        }
+        if (parent == NULL) {
+            result.push_back(highlight_job_t(node.source_start, node.source_length));
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
 void highlighter_t::color_node(const parse_node_t &node, highlight_spec_t color) {
     // Can only color nodes with valid source ranges.
     if (!node.has_source() || node.source_length == 0) return;
@@ -783,8 +928,13 @@ static bool node_is_potential_path(const wcstring &src, const parse_node_t &node
         // Put it back.
         if (!token.empty() && token.at(0) == HOME_DIRECTORY) token.at(0) = L'~';
 
-        const wcstring_list_t working_directory_list(1, working_directory);
-        result = is_potential_path(token, working_directory_list, PATH_EXPAND_TILDE);
+        const wcstring key =
+            validity_cache_key(highlight_check_potential_path, 0, token, working_directory);
+        if (!validity_cache_get(key, &result)) {
+            const wcstring_list_t working_directory_list(1, working_directory);
+            result = is_potential_path(token, working_directory_list, PATH_EXPAND_TILDE);
+            validity_cache_set(key, result);
+        }
     }
     return result;
 }
@@ -820,9 +970,16 @@ void highlighter_t::color_arguments(const parse_node_t &list_node) {
             if (expand_one(param, EXPAND_SKIP_CMDSUBST)) {
                 bool is_help = string_prefixes_string(param, L"--help") ||
                                string_prefixes_string(param, L"-h");
-                if (!is_help && this->io_ok &&
-                    !is_potential_cd_path(param, working_directory, PATH_EXPAND_TILDE)) {
-                    this->color_node(*child, highlight_spec_error);
+                if (!is_help && this->io_ok) {
+                    const wcstring key =
+                        validity_cache_key(highlight_check_cd_path, 0, param, working_directory);
+                    bool is_cd_path;
+                    if (!validity_cache_get(key, &is_cd_path)) {
+                        is_cd_path =
+                            is_potential_cd_path(param, working_directory, PATH_EXPAND_TILDE);
+                        validity_cache_set(key, is_cd_path);
+                    }
+                    if (!is_cd_path) this->color_node(*child, highlight_spec_error);
                 }
             }
         }
@@ -872,84 +1029,92 @@ void highlighter_t::color_redirection(const parse_node_t &redirection_node) {
                 // redirections). Note that the target is now unescaped.
                 const wcstring target_path =
                     path_apply_working_directory(target, this->working_directory);
-                switch (redirect_type) {
-                    case TOK_REDIRECT_FD: {
-                        // Target should be an fd. It must be all digits, and must not overflow.
-                        // fish_wcstoi returns INT_MAX on overflow; we could instead check errno to
-                        // disambiguiate this from a real INT_MAX fd, but instead we just disallow
-                        // that.
-                        const wchar_t *target_cstr = target.c_str();
-                        wchar_t *end = NULL;
-                        int fd = fish_wcstoi(target_cstr, &end, 10);
-
-                        // The iswdigit check ensures there's no leading whitespace, the *end check
-                        // ensures the entire string was consumed, and the numeric checks ensure the
-                        // fd is at least zero and there was no overflow.
-                        target_is_valid =
-                            (iswdigit(target_cstr[0]) && *end == L'\0' && fd >= 0 && fd < INT_MAX);
-                        break;
-                    }
-                    case TOK_REDIRECT_IN: {
-                        // Input redirections must have a readable non-directory.
-                        struct stat buf = {};
-                        target_is_valid = !waccess(target_path, R_OK) &&
-                                          !wstat(target_path, &buf) && !S_ISDIR(buf.st_mode);
-                        break;
-                    }
-                    case TOK_REDIRECT_OUT:
-                    case TOK_REDIRECT_APPEND:
-                    case TOK_REDIRECT_NOCLOB: {
-                        // Test whether the file exists, and whether it's writable (possibly after
-                        // creating it). access() returns failure if the file does not exist.
-                        bool file_exists = false, file_is_writable = false;
-                        int err = 0;
-
-                        struct stat buf = {};
-                        if (wstat(target_path, &buf) < 0) {
-                            err = errno;
+                const wcstring key = validity_cache_key(highlight_check_redirection, redirect_type,
+                                                        target, this->working_directory);
+                if (!validity_cache_get(key, &target_is_valid)) {
+                    switch (redirect_type) {
+                        case TOK_REDIRECT_FD: {
+                            // Target should be an fd. It must be all digits, and must not overflow.
+                            // fish_wcstoi returns INT_MAX on overflow; we could instead check errno
+                            // to disambiguiate this from a real INT_MAX fd, but instead we just
+                            // disallow that.
+                            const wchar_t *target_cstr = target.c_str();
+                            wchar_t *end = NULL;
+                            int fd = fish_wcstoi(target_cstr, &end, 10);
+
+                            // The iswdigit check ensures there's no leading whitespace, the *end
+                            // check ensures the entire string was consumed, and the numeric checks
+                            // ensure the fd is at least zero and there was no overflow.
+                            target_is_valid = (iswdigit(target_cstr[0]) && *end == L'\0' &&
+                                               fd >= 0 && fd < INT_MAX);
+                            break;
                         }
-
-                        if (string_suffixes_string(L"/", target)) {
-                            // Redirections to things that are directories is definitely not
-                            // allowed.
-                            file_exists = false;
-                            file_is_writable = false;
-                        } else if (err == 0) {
-                            // No err. We can write to it if it's not a directory and we have
-                            // permission.
-                            file_exists = true;
-                            file_is_writable = !S_ISDIR(buf.st_mode) && !waccess(target_path, W_OK);
-                        } else if (err == ENOENT) {
-                            // File does not exist. Check if its parent directory is writable.
-                            wcstring parent = wdirname(target_path);
-
-                            // Ensure that the parent ends with the path separator. This will ensure
-                            // that we get an error if the parent directory is not really a
-                            // directory.
-                            if (!string_suffixes_string(L"/", parent)) parent.push_back(L'/');
-
-                            // Now the file is considered writable if the parent directory is
-                            // writable.
-                            file_exists = false;
-                            file_is_writable = (0 == waccess(parent, W_OK));
-                        } else {
-                            // Other errors we treat as not writable. This includes things like
-                            // ENOTDIR.
-                            file_exists = false;
-                            file_is_writable = false;
+                        case TOK_REDIRECT_IN: {
+                            // Input redirections must have a readable non-directory.
+                            struct stat buf = {};
+                            target_is_valid = !waccess(target_path, R_OK) &&
+                                              !wstat(target_path, &buf) && !S_ISDIR(buf.st_mode);
+                            break;
                         }
+                        case TOK_REDIRECT_OUT:
+                        case TOK_REDIRECT_APPEND:
+                        case TOK_REDIRECT_NOCLOB: {
+                            // Test whether the file exists, and whether it's writable (possibly
+                            // after creating it). access() returns failure if the file does not
+                            // exist.
+                            bool file_exists = false, file_is_writable = false;
+                            int err = 0;
+
+                            struct stat buf = {};
+                            if (wstat(target_path, &buf) < 0) {
+                                err = errno;
+                            }
 
-                        // NOCLOB means that we must not overwrite files that exist.
-                        target_is_valid = file_is_writable &&
-                                          !(file_exists && redirect_type == TOK_REDIRECT_NOCLOB);
-                        break;
-                    }
-                    default: {
-                        // We should not get here, since the node was marked as a redirection, but
-                        // treat it as an error for paranoia.
-                        target_is_valid = false;
-                        break;
+                            if (string_suffixes_string(L"/", target)) {
+                                // Redirections to things that are directories is definitely not
+                                // allowed.
+                                file_exists = false;
+                                file_is_writable = false;
+                            } else if (err == 0) {
+                                // No err. We can write to it if it's not a directory and we have
+                                // permission.
+                                file_exists = true;
+                                file_is_writable =
+                                    !S_ISDIR(buf.st_mode) && !waccess(target_path, W_OK);
+                            } else if (err == ENOENT) {
+                                // File does not exist. Check if its parent directory is writable.
+                                wcstring parent = wdirname(target_path);
+
+                                // Ensure that the parent ends with the path separator. This will
+                                // ensure that we get an error if the parent directory is not really
+                                // a directory.
+                                if (!string_suffixes_string(L"/", parent)) parent.push_back(L'/');
+
+                                // Now the file is considered writable if the parent directory is
+                                // writable.
+                                file_exists = false;
+                                file_is_writable = (0 == waccess(parent, W_OK));
+                            } else {
+                                // Other errors we treat as not writable. This includes things like
+                                // ENOTDIR.
+                                file_exists = false;
+                                file_is_writable = false;
+                            }
+
+                            // NOCLOB means that we must not overwrite files that exist.
+                            target_is_valid =
+                                file_is_writable &&
+                                !(file_exists && redirect_type == TOK_REDIRECT_NOCLOB);
+                            break;
+                        }
+                        default: {
+                            // We should not get here, since the node was marked as a redirection,
+                            // but treat it as an error for paranoia.
+                            target_is_valid = false;
+                            break;
+                        }
                     }
+                    validity_cache_set(key, target_is_valid);
                 }
             }
 
@@ -1015,7 +1180,7 @@ static bool command_is_valid(const wcstring &cmd, enum parse_statement_decoratio
     if (!is_valid && abbreviation_ok) is_valid = expand_abbreviation(cmd, NULL);
 
     // Regular commands
-    if (!is_valid && command_ok) is_valid = path_get_path(cmd, NULL, vars);
+    if (!is_valid && command_ok) is_valid = path_get_path_cached(cmd, NULL, vars);
 
     // Implicit cd
     if (!is_valid && implicit_cd_ok)
@@ -1025,7 +1190,18 @@ static bool command_is_valid(const wcstring &cmd, enum parse_statement_decoratio
     return is_valid;
 }
 
-const highlighter_t::color_array_t &highlighter_t::highlight() {
+/// Returns whether the node lies within one of the given jobs, which must be sorted.
+static bool node_is_in_jobs(const parse_node_t &node, const std::vector<highlight_job_t> &jobs) {
+    if (!node.has_source() || jobs.empty()) return false;
+    std::vector<highlight_job_t>::const_iterator iter = std::upper_bound(
+        jobs.begin(), jobs.end(), highlight_job_t(node.source_start, node.source_length));
+    if (iter == jobs.begin()) return false;
+    --iter;
+    return node.source_start + node.source_length <= iter->end();
+}
+
+const highlighter_t::color_array_t &highlighter_t::highlight(const highlight_record_t *previous,
+                                                             highlight_record_t *record) {
     // If we are doing I/O, we must be in a background thread.
     if (io_ok) {
         ASSERT_IS_BACKGROUND_THREAD();
@@ -1038,6 +1214,55 @@ const highlighter_t::color_array_t &highlighter_t::highlight() {
     // Start out at zero.
     std::fill(this->color_array.begin(), this->color_array.end(), 0);
 
+    // Find the top level jobs that the edit since the previous highlight did not touch. Their
+    // colors can be copied from it, provided they are not stale and do not depend on the cursor. A
+    // job is untouched if it and the characters on either side of it are in the common prefix or
+    // the common suffix of the two command lines, since nothing in a job that parses without
+    // errors depends on text outside of it.
+    std::vector<highlight_job_t> jobs;
+    std::vector<highlight_job_t> reused_jobs;
+    const double now = timef();
+    if (record != NULL) jobs = this->top_level_jobs();
+    if (previous != NULL && previous->reusable && !this->parse_errored &&
+        previous->working_directory == this->working_directory) {
+        const wcstring &old_buff = previous->buff;
+        const size_t max_common = std::min(length, old_buff.size());
+        size_t prefix = 0, suffix = 0;
+        while (prefix < max_common && buff.at(prefix) == old_buff.at(prefix)) prefix++;
+        while (suffix < max_common - prefix &&
+               buff.at(length - suffix - 1) == old_buff.at(old_buff.size() - suffix - 1)) {
+            suffix++;
+        }
+
+        for (size_t i = 0; i < jobs.size(); i++) {
+            highlight_job_t &job = jobs.at(i);
+            size_t old_start;
+            if (job.end() < prefix) {
+                old_start = job.start;
+            } else if (job.start > length - suffix) {
+                old_start = job.start - length + old_buff.size();
+            } else {
+                continue;
+            }
+
+            const std::vector<highlight_job_t> &old_jobs = previous->jobs;
+            std::vector<highlight_job_t>::const_iterator old_job = std::lower_bound(
+                old_jobs.begin(), old_jobs.end(), highlight_job_t(old_start, job.length));
+            if (old_job == old_jobs.end() || old_job->start != old_start ||
+                old_job->length != job.length || old_job->has_cursor ||
+                now - old_job->when >= HIGHLIGHT_CACHE_LIFETIME) {
+                continue;
+            }
+            if (this->cursor_pos >= job.start && this->cursor_pos <= job.end()) continue;
+
+            job.when = old_job->when;
+            reused_jobs.push_back(job);
+            std::copy(previous->colors.begin() + old_start,
+                      previous->colors.begin() + old_start + job.length,
+                      this->color_array.begin() + job.start);
+        }
+    }
+
 #if 0
     // Disabled for the 2.2.0 release: https://github.com/fish-shell/fish-shell/issues/1809.
     const wcstring dump = parse_dump_tree(parse_tree, buff);
@@ -1048,6 +1273,7 @@ const highlighter_t::color_array_t &highlighter_t::highlight() {
     for (parse_node_tree_t::const_iterator iter = parse_tree.begin(); iter != parse_tree.end();
          ++iter) {
         const parse_node_t &node = *iter;
+        if (node_is_in_jobs(node, reused_jobs)) continue;
 
         switch (node.type) {
             // Color direct string descendants, e.g. 'for' and 'in'.
@@ -1118,7 +1344,13 @@ const highlighter_t::color_array_t &highlighter_t::highlight() {
                     bool expanded = expand_one(
                         cmd, EXPAND_SKIP_CMDSUBST | EXPAND_SKIP_VARIABLES | EXPAND_SKIP_JOBS);
                     if (expanded && !has_expand_reserved(cmd)) {
-                        is_valid_cmd = command_is_valid(cmd, decoration, working_directory, vars);
+                        const wcstring key = validity_cache_key(highlight_check_command, decoration,
+                                                                cmd, working_directory);
+                        if (!validity_cache_get(key, &is_valid_cmd)) {
+                            is_valid_cmd =
+                                command_is_valid(cmd, decoration, working_directory, vars);
+                            validity_cache_set(key, is_valid_cmd);
+                        }
                     }
                 }
                 this->color_node(*cmd_node,
@@ -1151,7 +1383,20 @@ const highlighter_t::color_array_t &highlighter_t::highlight() {
         }
     }
 
+    if (record != NULL) {
+        for (size_t i = 0; i < jobs.size(); i++) {
+            highlight_job_t &job = jobs.at(i);
+            if (job.when == 0) job.when = now;
+            job.has_cursor = this->cursor_pos >= job.start && this->cursor_pos <= job.end();
+        }
+        record->buff = this->buff;
+        record->working_directory = this->working_directory;
+        record->jobs.swap(jobs);
+        record->reusable = !this->parse_errored;
+    }
+
     if (!this->io_ok || this->cursor_pos > this->buff.size()) {
+        if (record != NULL) record->colors = color_array;
         return color_array;
     }
 
@@ -1179,6 +1424,7 @@ const highlighter_t::color_array_t &highlighter_t::highlight() {
         }
     }
 
+    if (record != NULL) record->colors = color_array;
     return color_array;
 }
 
@@ -1189,9 +1435,18 @@ void highlight_shell(const wcstring &buff, std::vector<highlight_spec_t> &color,
     // should really be passed in.
     const wcstring working_directory = env_get_pwd_slash();
 
-    // Highlight it!
+    // Highlight it, starting from the last command line we highlighted, which is usually this one
+    // before the latest edit.
+    highlight_record_t previous, record;
+    {
+        scoped_lock locker(last_highlight_lock);
+        previous = last_highlight;
+    }
     highlighter_t highlighter(buff, pos, vars, working_directory, true /* can do IO */);
-    color = highlighter.highlight();
+    color = highlighter.highlight(&previous, &record);
+
+    scoped_lock locker(last_highlight_lock);
+    last_highlight.swap(record);
 }
 
 void highlight_shell_no_io(const wcstring &buff, std::vector<highlight_spec_t> &color, size_t pos,
@@ -77,6 +77,11 @@ struct file_detection_context_t;
 void highlight_shell(const wcstring &buffstr, std::vector<highlight_spec_t> &color, size_t pos,
                      wcstring_list_t *error, const env_vars_snapshot_t &vars);
 
+/// Forget the results of checks highlight_shell has cached, and the command line it last
+/// highlighted. This should be called after running a command, since it may have defined functions
+/// or created files.
+void highlight_cache_clear();
+
 /// Perform a non-blocking shell highlighting. The function will not do any I/O that may block. As a
 /// result, invalid commands may not be detected, etc.
 void highlight_shell_no_io(const wcstring &buffstr, std::vector<highlight_spec_t> &color,
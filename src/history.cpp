@@ -56,6 +56,28 @@ namespace {
 /// flush at record boundaries, and avoids the copying of ostringstream. Have you ever tried to
 /// implement your own streambuf? Total insanity.
 static size_t safe_strlen(const char *s) { return s ? strlen(s) : 0; }
+/// Extends a checksum of some bytes to a checksum of those bytes followed by len more bytes. The
+/// checksum of no bytes is 0. This is a polynomial hash, so the checksum of two runs of bytes can
+/// also be combined from their separate checksums, see history_checksum_concat.
+#define HISTORY_CHECKSUM_MULTIPLIER 1099511628211ULL
+
+static uint64_t history_checksum_extend(uint64_t checksum, const char *bytes, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        checksum = checksum * HISTORY_CHECKSUM_MULTIPLIER + (unsigned char)bytes[i] + 1;
+    }
+    return checksum;
+}
+
+/// Returns the checksum of bytes a followed by bytes b, given their checksums and the length of b.
+static uint64_t history_checksum_concat(uint64_t checksum_a, uint64_t checksum_b, uint64_t len_b) {
+    uint64_t power = 1, base = HISTORY_CHECKSUM_MULTIPLIER;
+    for (; len_b > 0; len_b >>= 1) {
+        if (len_b & 1) power *= base;
+        base *= base;
+    }
+    return checksum_a * power + checksum_b;
+}
+
 class history_output_buffer_t {
     // A null-terminated C string.
     std::vector<char> buffer;
@@ -94,8 +116,10 @@ class history_output_buffer_t {
         assert(buffer.at(buffer.size() - 1) == '\0');
     }
 
-    /// Output to a given fd, resetting our buffer. Returns true on success, false on error.
-    bool flush_to_fd(int fd) {
+    /// Output to a given fd, resetting our buffer. Returns true on success, false on error. If
+    /// checksum is not NULL, it is extended with the output, see history_checksum_extend.
+    bool flush_to_fd(int fd, uint64_t *checksum = NULL) {
+        if (checksum != NULL) *checksum = history_checksum_extend(*checksum, &buffer.at(0), offset);
         bool result = write_loop(fd, &buffer.at(0), offset) >= 0;
         offset = 0;
         return result;
@@ -131,6 +155,37 @@ static bool history_file_lock(int fd, short type) {
     return ret != -1;
 }
 
+// The history index is a sidecar file next to the history file (e.g. fish_history.index). It
+// stores the offset and signature of each item, so that searches can skip items that cannot match
+// without decoding them. It is only a cache: it is tied to the identity, modification time and
+// contents of the history file, and is ignored if any of them differ. A history file that was
+// changed by someone who does not maintain the index (e.g. an older fish) is searched without it
+// until the file is next rewritten, which rebuilds the index.
+//
+// The index is rewritten whenever the history file is rewritten, and appended to (under the
+// history file's lock) whenever we append to the history file. Its layout is a header followed by
+// an array of records, all in native byte order.
+#define HISTORY_INDEX_MAGIC "fishidx2"
+
+struct history_index_header_t {
+    char magic[8];
+    uint64_t device;
+    uint64_t inode;
+    // Modification time of the history file when the index was last brought up to date with it.
+    int64_t mod_seconds;
+    int64_t mod_nanoseconds;
+    // Number of records following the header.
+    uint64_t count;
+    // Length of the prefix of the history file that the records describe, and its checksum.
+    uint64_t covered_length;
+    uint64_t covered_checksum;
+};
+
+struct history_index_record_t {
+    uint64_t offset;
+    history_signature_t signature;
+};
+
 /// Our LRU cache is used for restricting the amount of history we have, and limiting how long we
 /// order it.
 class history_lru_node_t : public lru_node_t {
@@ -192,6 +247,11 @@ static history_collection_t histories;
 
 static wcstring history_filename(const wcstring &name, const wcstring &suffix);
 
+/// Reads the index for the history file with the given name and ID, whose contents are given.
+static bool read_history_index(const wcstring &name, const file_id_t &history_id,
+                               const char *history_start, size_t history_length,
+                               std::vector<history_index_record_t> *out_records);
+
 /// Replaces newlines with a literal backslash followed by an n, and replaces backslashes with two
 /// backslashes.
 static void escape_yaml(std::string *str);
@@ -412,6 +472,134 @@ static history_item_t decode_item(const char *base, size_t len, history_file_typ
     return history_item_t(L"");
 }
 
+/// Locates the (still escaped) command of the fish 2.0 item at the start of the given region,
+/// without decoding it. Returns false if the region does not start with a "- cmd:" line, in which
+/// case decode_item_fish_2_0 produces an empty item.
+static bool escaped_command_fish_2_0(const char *base, size_t len, const char **out_cmd,
+                                     size_t *out_len) {
+    const char *line_end = (const char *)memchr(base, '\n', len);
+    if (line_end == NULL) return false;
+
+    const char *line_start = base;
+    while (line_start < line_end && *line_start == ' ') line_start++;
+
+    const char *colon = (const char *)memchr(line_start, ':', line_end - line_start);
+    const size_t key_len = strlen("- cmd");
+    if (colon == NULL || (size_t)(colon - line_start) != key_len ||
+        memcmp(line_start, "- cmd", key_len) != 0) {
+        return false;
+    }
+
+    // Skip a space after the : if necessary, like extract_prefix_and_unescape_yaml.
+    const char *cmd = colon + 1;
+    if (cmd < line_end && *cmd == ' ') cmd++;
+    *out_cmd = cmd;
+    *out_len = line_end - cmd;
+    return true;
+}
+
+/// Folds ASCII letters to lowercase. Signatures ignore ASCII case, so that one signature serves both
+/// case sensitive and case insensitive searches.
+static inline unsigned char fold_ascii_case(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+void history_signature_t::add_trigram(unsigned char a, unsigned char b, unsigned char c) {
+    uint32_t hash = ((uint32_t)fold_ascii_case(a) << 16) | ((uint32_t)fold_ascii_case(b) << 8) |
+                    fold_ascii_case(c);
+    // Multiplicative hashing; the top 7 bits select one of our 128 bits.
+    unsigned bit = (uint32_t)(hash * 2654435761u) >> 25;
+    bits[bit / 64] |= (uint64_t)1 << (bit % 64);
+}
+
+history_signature_t history_signature_t::for_escaped_command(const char *cmd, size_t len) {
+    history_signature_t result;
+    for (size_t i = 2; i < len; i++) {
+        result.add_trigram(cmd[i - 2], cmd[i - 1], cmd[i]);
+    }
+    return result;
+}
+
+history_signature_t history_signature_t::for_search_term(const wcstring &term,
+                                                         bool case_sensitive) {
+    // Escaping is a per-character substitution, so if the term is contained in a command, the
+    // escaped term is contained in the escaped command.
+    std::string narrow = wcs2string(term);
+    escape_yaml(&narrow);
+
+    history_signature_t result;
+    for (size_t i = 2; i < narrow.size(); i++) {
+        // Only use trigrams of ASCII characters, since only those are encoded the same way in
+        // every locale. Case insensitive searches compare towlower'd strings, and a few non-ASCII
+        // characters lowercase to ASCII (KELVIN SIGN to 'k', LATIN CAPITAL LETTER I WITH DOT ABOVE
+        // to 'i'), so those letters are not usable either. Finally, skip backslashes: a history
+        // file may contain backslashes that are not escapes, which unescape to themselves.
+        bool usable = true;
+        for (size_t j = i - 2; j <= i && usable; j++) {
+            unsigned char c = narrow[j];
+            usable = c < 0x80 && c != '\\' && (case_sensitive || (c != 'i' && c != 'k'));
+        }
+        if (usable) result.add_trigram(narrow[i - 2], narrow[i - 1], narrow[i]);
+    }
+    return result;
+}
+
+history_raw_matcher_t::history_raw_matcher_t()
+    : search_type(HISTORY_SEARCH_TYPE_CONTAINS), case_sensitive(true), term_is_ascii(true) {}
+
+history_raw_matcher_t::history_raw_matcher_t(const wcstring &term,
+                                             enum history_search_type_t type, bool case_sensitive)
+    : narrow_term(wcs2string(term)),
+      signature(history_signature_t::for_search_term(term, case_sensitive)),
+      search_type(type),
+      case_sensitive(case_sensitive),
+      term_is_ascii(true) {
+    for (size_t i = 0; i < narrow_term.size(); i++) {
+        if ((unsigned char)narrow_term[i] >= 0x80) term_is_ascii = false;
+        // Case insensitive searches lowercase the term; lowercase ours the same way.
+        if (!case_sensitive) narrow_term[i] = fold_ascii_case(narrow_term[i]);
+    }
+}
+
+bool history_raw_matcher_t::command_may_match(const char *escaped_cmd, size_t len) const {
+    // Case insensitive searches compare towlower'd strings, which we can only replicate on raw
+    // bytes if both sides are ASCII.
+    if (!case_sensitive && !term_is_ascii) return true;
+
+    // Most commands contain no backslashes, in which case the escaped command is the command
+    // itself and we can search the mapped bytes directly. Otherwise unescape it first.
+    const char *haystack = escaped_cmd;
+    size_t haystack_len = len;
+    std::string unescaped;
+    const bool has_backslash = memchr(escaped_cmd, '\\', len) != NULL;
+    if (has_backslash || !case_sensitive) {
+        unescaped.assign(escaped_cmd, len);
+        if (has_backslash) unescape_yaml(&unescaped);
+        if (!case_sensitive) {
+            for (size_t i = 0; i < unescaped.size(); i++) {
+                // Non-ASCII characters may lowercase to anything; let the caller decide.
+                if ((unsigned char)unescaped[i] >= 0x80) return true;
+                unescaped[i] = fold_ascii_case(unescaped[i]);
+            }
+        }
+        haystack = unescaped.data();
+        haystack_len = unescaped.size();
+    }
+
+    const char *needle = narrow_term.data();
+    const size_t needle_len = narrow_term.size();
+
+    // Like matches_search, strings of equal length must match exactly.
+    if (search_type == HISTORY_SEARCH_TYPE_EXACT || needle_len == haystack_len) {
+        return needle_len == haystack_len && !memcmp(haystack, needle, needle_len);
+    } else if (needle_len > haystack_len) {
+        return false;
+    } else if (search_type == HISTORY_SEARCH_TYPE_PREFIX) {
+        return !memcmp(haystack, needle, needle_len);
+    }
+    return needle_len == 0 || memmem(haystack, haystack_len, needle, needle_len) != NULL;
+}
+
 /// We can merge two items if they are the same command. We use the more recent timestamp, more
 /// recent identifier, and the longer list of required paths.
 bool history_item_t::merge(const history_item_t &item) {
@@ -478,12 +666,17 @@ bool history_item_t::matches_search(const wcstring &term, enum history_search_ty
 }
 
 /// Append our YAML history format to the provided vector at the given offset, updating the offset.
+/// If out_signature is not NULL, the signature of the command is returned by reference.
 static void append_yaml_to_buffer(const wcstring &wcmd, time_t timestamp,
                                   const path_list_t &required_paths,
-                                  history_output_buffer_t *buffer) {
+                                  history_output_buffer_t *buffer,
+                                  history_signature_t *out_signature = NULL) {
     std::string cmd = wcs2string(wcmd);
     escape_yaml(&cmd);
     buffer->append("- cmd: ", cmd.c_str(), "\n");
+    if (out_signature != NULL) {
+        *out_signature = history_signature_t::for_escaped_command(cmd.data(), cmd.size());
+    }
 
     char timestamp_str[96];
     snprintf(timestamp_str, sizeof timestamp_str, "%ld", (long)timestamp);
@@ -925,6 +1118,75 @@ void history_t::populate_from_mmap(void) {
     }
 }
 
+void history_t::populate_signatures(void) {
+    old_item_signatures.clear();
+    if (mmap_type != history_type_fish_2_0) return;
+
+    std::vector<history_index_record_t> records;
+    read_history_index(name, mmap_file_id, mmap_start, mmap_length, &records);
+
+    // Both the index records and our offsets are sorted by offset. The index may describe items we
+    // skipped (e.g. because of the boundary timestamp), and may not describe items that were
+    // appended by shells that do not maintain the index; compute signatures for those.
+    size_t record_idx = 0;
+    for (std::deque<size_t>::const_iterator iter = old_item_offsets.begin();
+         iter != old_item_offsets.end(); ++iter) {
+        const size_t offset = *iter;
+        while (record_idx < records.size() && records.at(record_idx).offset < offset) {
+            record_idx++;
+        }
+
+        if (record_idx < records.size() && records.at(record_idx).offset == offset) {
+            old_item_signatures.push_back(records.at(record_idx).signature);
+            continue;
+        }
+
+        const char *cmd;
+        size_t cmd_len;
+        history_signature_t signature;
+        if (escaped_command_fish_2_0(mmap_start + offset, mmap_length - offset, &cmd, &cmd_len)) {
+            signature = history_signature_t::for_escaped_command(cmd, cmd_len);
+        } else {
+            // This decodes to an empty item, which must not be skipped since it ends searches.
+            signature.bits[0] = signature.bits[1] = ~(uint64_t)0;
+        }
+        old_item_signatures.push_back(signature);
+    }
+}
+
+bool history_t::item_at_index_may_match(size_t idx, const history_raw_matcher_t &matcher) {
+    scoped_lock locker(lock);
+
+    // This follows the same indexing as item_at_index.
+    assert(idx > 0);
+    idx--;
+
+    size_t resolved_new_item_count = new_items.size();
+    if (this->has_pending_item && resolved_new_item_count > 0) {
+        resolved_new_item_count -= 1;
+    }
+
+    // New items have no signature; they are few and already decoded.
+    if (idx < resolved_new_item_count) return true;
+
+    idx -= resolved_new_item_count;
+    load_old_if_needed();
+    size_t old_item_count = old_item_signatures.size();
+    if (old_item_count == old_item_offsets.size() && idx < old_item_count) {
+        // Signatures are only computed for fish 2.0 files, so we can also look at the raw command.
+        const size_t which = old_item_count - idx - 1;
+        if (!matcher.signature_may_match(old_item_signatures.at(which))) return false;
+
+        const size_t offset = old_item_offsets.at(which);
+        const char *cmd;
+        size_t cmd_len;
+        if (escaped_command_fish_2_0(mmap_start + offset, mmap_length - offset, &cmd, &cmd_len)) {
+            return matcher.command_may_match(cmd, cmd_len);
+        }
+    }
+    return true;
+}
+
 /// Do a private, read-only map of the entirety of a history file with the given name. Returns true
 /// if successful. Returns the mapped memory region by reference.
 bool history_t::map_file(const wcstring &name, const char **out_map_start, size_t *out_map_len,
@@ -984,6 +1246,7 @@ bool history_t::load_old_if_needed(void) {
         ok = true;
         time_profiler_t profiler("populate_from_mmap");  //!OCLINT(side-effect)
         this->populate_from_mmap();
+        this->populate_signatures();
     }
 
     // signal_unblock();
@@ -1024,6 +1287,11 @@ bool history_search_t::go_backwards() {
             return false;
         }
 
+        // Skip items that cannot match without decoding them.
+        if (!history->item_at_index_may_match(idx, raw_matcher)) {
+            continue;
+        }
+
         const history_item_t item = history->item_at_index(idx);
         // We're done if it's empty or we cancelled.
         if (item.empty()) {
@@ -1131,6 +1399,146 @@ static wcstring history_filename(const wcstring &name, const wcstring &suffix) {
     return result;
 }
 
+/// Creates a temporary file from a template ending in XXXXXX, opened CLO_EXEC. Returns the fd (or
+/// -1 on failure), and the path of the file by reference.
+static int create_temporary_file(const wcstring &name_template, wcstring *out_path) {
+    // Try to create a temporary file, up to 10 times. We don't use mkstemps because we want to
+    // open it CLO_EXEC. This should almost always succeed on the first try.
+    int out_fd = -1;
+    for (size_t attempt = 0; attempt < 10 && out_fd == -1; attempt++) {
+        char *narrow_str = wcs2str(name_template.c_str());
+#if HAVE_MKOSTEMP
+        out_fd = mkostemp(narrow_str, O_CLOEXEC);
+        if (out_fd >= 0) {
+            *out_path = str2wcstring(narrow_str);
+        }
+#else
+        if (narrow_str && mktemp(narrow_str)) {
+            // It was successfully templated; try opening it atomically.
+            *out_path = str2wcstring(narrow_str);
+            out_fd = wopen_cloexec(*out_path, O_WRONLY | O_CREAT | O_EXCL | O_TRUNC, 0600);
+        }
+#endif
+        free(narrow_str);
+    }
+    return out_fd;
+}
+
+/// Returns whether the given index header was brought up to date with the history file with the
+/// given ID. The caller still has to check that the covered part of the file is unchanged.
+static bool history_index_header_matches(const history_index_header_t &header,
+                                         const file_id_t &history_id) {
+    return !memcmp(header.magic, HISTORY_INDEX_MAGIC, sizeof header.magic) &&
+           header.device == (uint64_t)history_id.device &&
+           header.inode == (uint64_t)history_id.inode &&
+           header.mod_seconds == (int64_t)history_id.mod_seconds &&
+           header.mod_nanoseconds == (int64_t)history_id.mod_nanoseconds &&
+           header.covered_length <= history_id.size;
+}
+
+/// Reads the index for the history file with the given name and ID, whose contents are given.
+/// Returns the records describing the history file by reference, or false if there is no usable
+/// index.
+static bool read_history_index(const wcstring &name, const file_id_t &history_id,
+                               const char *history_start, size_t history_length,
+                               std::vector<history_index_record_t> *out_records) {
+    out_records->clear();
+    wcstring path = history_filename(name, L".index");
+    if (path.empty()) return false;
+
+    int fd = wopen_cloexec(path, O_RDONLY);
+    if (fd == -1) return false;
+
+    bool result = false;
+    history_index_header_t header;
+    struct stat buf;
+    if (read_loop(fd, &header, sizeof header) == (ssize_t)sizeof header &&
+        history_index_header_matches(header, history_id) &&
+        header.covered_length <= history_length &&
+        header.covered_checksum ==
+            history_checksum_extend(0, history_start, (size_t)header.covered_length) &&
+        fstat(fd, &buf) == 0 &&
+        (uint64_t)buf.st_size >= sizeof header + header.count * sizeof(history_index_record_t)) {
+        size_t bytes = header.count * sizeof(history_index_record_t);
+        out_records->resize(header.count);
+        result = (bytes == 0 || read_loop(fd, &out_records->at(0), bytes) == (ssize_t)bytes);
+        if (!result) out_records->clear();
+    }
+    close(fd);
+    return result;
+}
+
+/// Appends records to the index for a history file, after items with the given checksum were
+/// appended to it between start_offset and end_offset. old_id and new_id identify the file before
+/// and after appending. The index is left alone if it was not up to date with the file right up to
+/// start_offset; it will be rebuilt when the history file is next rewritten. The caller must hold
+/// the history file's write lock.
+static void append_history_index(const wcstring &name, const file_id_t &old_id,
+                                 const file_id_t &new_id, uint64_t start_offset,
+                                 uint64_t end_offset, uint64_t appended_checksum,
+                                 const std::vector<history_index_record_t> &records) {
+    wcstring path = history_filename(name, L".index");
+    if (path.empty()) return;
+
+    int fd = wopen_cloexec(path, O_RDWR);
+    if (fd == -1) return;
+
+    history_index_header_t header;
+    if (pread(fd, &header, sizeof header, 0) == (ssize_t)sizeof header &&
+        history_index_header_matches(header, old_id) && header.covered_length == start_offset &&
+        old_id.size == start_offset) {
+        // Write the records first and the header last, so that readers never see a header that
+        // describes records that are not there yet.
+        size_t bytes = records.size() * sizeof(history_index_record_t);
+        off_t where = sizeof header + header.count * sizeof(history_index_record_t);
+        if (bytes == 0 || pwrite(fd, &records.at(0), bytes, where) == (ssize_t)bytes) {
+            header.count += records.size();
+            header.covered_length = end_offset;
+            header.covered_checksum = history_checksum_concat(
+                header.covered_checksum, appended_checksum, end_offset - start_offset);
+            header.mod_seconds = (int64_t)new_id.mod_seconds;
+            header.mod_nanoseconds = (int64_t)new_id.mod_nanoseconds;
+            if (pwrite(fd, &header, sizeof header, 0) != (ssize_t)sizeof header) {
+                debug(2, L"Error %d when writing history index", errno);
+            }
+        }
+    }
+    close(fd);
+}
+
+/// Replaces the index for the history file with the given name and ID, whose contents have the given
+/// length and checksum.
+static void write_history_index(const wcstring &name, const file_id_t &history_id,
+                                uint64_t history_length, uint64_t history_checksum,
+                                const std::vector<history_index_record_t> &records) {
+    wcstring path = history_filename(name, L".index");
+    if (path.empty()) return;
+
+    wcstring tmp_path;
+    int fd = create_temporary_file(history_filename(name, L".index.XXXXXX"), &tmp_path);
+    if (fd == -1) return;
+
+    history_index_header_t header = {};
+    memcpy(header.magic, HISTORY_INDEX_MAGIC, sizeof header.magic);
+    header.device = (uint64_t)history_id.device;
+    header.inode = (uint64_t)history_id.inode;
+    header.mod_seconds = (int64_t)history_id.mod_seconds;
+    header.mod_nanoseconds = (int64_t)history_id.mod_nanoseconds;
+    header.count = records.size();
+    header.covered_length = history_length;
+    header.covered_checksum = history_checksum;
+
+    size_t bytes = records.size() * sizeof(history_index_record_t);
+    bool ok = write_loop(fd, (const char *)&header, sizeof header) >= 0 &&
+              (bytes == 0 || write_loop(fd, (const char *)&records.at(0), bytes) >= 0);
+    close(fd);
+
+    if (!ok || wrename(tmp_path, path) == -1) {
+        debug(2, L"Error %d when writing history index", errno);
+        wunlink(tmp_path);
+    }
+}
+
 void history_t::clear_file_state() {
     ASSERT_IS_LOCKED(lock);
     // Erase everything we know about our file.
@@ -1141,6 +1549,7 @@ void history_t::clear_file_state() {
     mmap_length = 0;
     loaded_old = false;
     old_item_offsets.clear();
+    old_item_signatures.clear();
 }
 
 void history_t::compact_new_items() {
@@ -1226,42 +1635,32 @@ bool history_t::save_internal_via_rewrite() {
 
         signal_block();
 
-        // Try to create a temporary file, up to 10 times. We don't use mkstemps because we want to
-        // open it CLO_EXEC. This should almost always succeed on the first try.
-        int out_fd = -1;
         wcstring tmp_name;
-        for (size_t attempt = 0; attempt < 10 && out_fd == -1; attempt++) {
-            char *narrow_str = wcs2str(tmp_name_template.c_str());
-#if HAVE_MKOSTEMP
-            out_fd = mkostemp(narrow_str, O_CLOEXEC);
-            if (out_fd >= 0) {
-                tmp_name = str2wcstring(narrow_str);
-            }
-#else
-            if (narrow_str && mktemp(narrow_str)) {
-                // It was successfully templated; try opening it atomically.
-                tmp_name = str2wcstring(narrow_str);
-                out_fd = wopen_cloexec(tmp_name, O_WRONLY | O_CREAT | O_EXCL | O_TRUNC, 0600);
-            }
-#endif
-            free(narrow_str);
-        }
-
+        int out_fd = create_temporary_file(tmp_name_template, &tmp_name);
         if (out_fd >= 0) {
-            // Write them out.
+            // Write them out, remembering where each item went for the index.
             bool errored = false;
             history_output_buffer_t buffer;
+            std::vector<history_index_record_t> index_records;
+            uint64_t flushed_length = 0, flushed_checksum = 0;
             for (history_lru_cache_t::iterator iter = lru.begin(); iter != lru.end(); ++iter) {
                 const history_lru_node_t *node = *iter;
-                append_yaml_to_buffer(node->key, node->timestamp, node->required_paths, &buffer);
-                if (buffer.output_size() >= HISTORY_OUTPUT_BUFFER_SIZE &&
-                    !buffer.flush_to_fd(out_fd)) {
-                    errored = true;
-                    break;
+                history_index_record_t record;
+                record.offset = flushed_length + buffer.output_size();
+                append_yaml_to_buffer(node->key, node->timestamp, node->required_paths, &buffer,
+                                      &record.signature);
+                index_records.push_back(record);
+                if (buffer.output_size() >= HISTORY_OUTPUT_BUFFER_SIZE) {
+                    flushed_length += buffer.output_size();
+                    if (!buffer.flush_to_fd(out_fd, &flushed_checksum)) {
+                        errored = true;
+                        break;
+                    }
                 }
             }
+            flushed_length += buffer.output_size();
 
-            if (!errored && buffer.flush_to_fd(out_fd)) {
+            if (!errored && buffer.flush_to_fd(out_fd, &flushed_checksum)) {
                 ok = true;
             }
 
@@ -1286,8 +1685,13 @@ bool history_t::save_internal_via_rewrite() {
                     }
                 }
 
+                // The renamed file keeps its identity, so the index can be tied to it now.
+                const file_id_t new_file_id = file_id_for_fd(out_fd);
                 if (wrename(tmp_name, new_name) == -1) {
                     debug(2, L"Error %d when renaming history file", errno);
+                } else {
+                    write_history_index(name, new_file_id, flushed_length, flushed_checksum,
+                                        index_records);
                 }
             }
             close(out_fd);
@@ -1335,7 +1739,8 @@ bool history_t::save_internal_via_appending() {
     int out_fd = wopen_cloexec(history_path, O_WRONLY | O_APPEND);
     if (out_fd >= 0) {
         // Check to see if the file changed.
-        if (file_id_for_fd(out_fd) != mmap_file_id) file_changed = true;
+        const file_id_t file_id = file_id_for_fd(out_fd);
+        if (file_id != mmap_file_id) file_changed = true;
 
         // Exclusive lock on the entire file. This is released when we close the file (below). This
         // may fail on (e.g.) lockless NFS. If so, proceed as if it did not fail; the risk is that
@@ -1344,7 +1749,10 @@ bool history_t::save_internal_via_appending() {
         // by writing with O_APPEND.
         //
         // Simulate a failing lock in chaos_mode
-        if (!chaos_mode) history_file_lock(out_fd, F_WRLCK);
+        bool locked = !chaos_mode && history_file_lock(out_fd, F_WRLCK);
+
+        // What the file looks like now that nobody else can append to it, for the index.
+        const file_id_t locked_file_id = file_id_for_fd(out_fd);
 
         // We (hopefully successfully) took the exclusive lock. Append to the file.
         // Note that this is sketchy for a few reasons:
@@ -1366,13 +1774,24 @@ bool history_t::save_internal_via_appending() {
         // So far so good. Write all items at or after first_unwritten_new_item_index. Note that we
         // write even a pending item - pending items are ignored by history within the command
         // itself, but should still be written to the file.
+        //
+        // We also remember where each item went, so we can append it to the index. Since we
+        // append, the items start at the current end of the file.
         bool errored = false;
         history_output_buffer_t buffer;
+        std::vector<history_index_record_t> index_records;
+        const off_t start_offset = lseek(out_fd, 0, SEEK_END);
+        uint64_t end_offset = start_offset, appended_checksum = 0;
         while (first_unwritten_new_item_index < new_items.size()) {
             const history_item_t &item = new_items.at(first_unwritten_new_item_index);
-            append_yaml_to_buffer(item.str(), item.timestamp(), item.get_required_paths(), &buffer);
+            history_index_record_t record;
+            record.offset = end_offset + buffer.output_size();
+            append_yaml_to_buffer(item.str(), item.timestamp(), item.get_required_paths(), &buffer,
+                                  &record.signature);
+            index_records.push_back(record);
             if (buffer.output_size() >= HISTORY_OUTPUT_BUFFER_SIZE) {
-                errored = !buffer.flush_to_fd(out_fd);
+                end_offset += buffer.output_size();
+                errored = !buffer.flush_to_fd(out_fd, &appended_checksum);
                 if (errored) break;
             }
 
@@ -1380,10 +1799,17 @@ bool history_t::save_internal_via_appending() {
             first_unwritten_new_item_index++;
         }
 
-        if (!errored && buffer.flush_to_fd(out_fd)) {
+        end_offset += buffer.output_size();
+        if (!errored && buffer.flush_to_fd(out_fd, &appended_checksum)) {
             ok = true;
         }
 
+        // Only touch the index if we hold the lock, since otherwise our offsets may be wrong.
+        if (ok && locked && start_offset != (off_t)-1) {
+            append_history_index(name, locked_file_id, file_id_for_fd(out_fd), start_offset,
+                                 end_offset, appended_checksum, index_records);
+        }
+
         close(out_fd);
     }
 
@@ -1506,6 +1932,8 @@ void history_t::clear(void) {
     old_item_offsets.clear();
     wcstring filename = history_filename(name, L"");
     if (!filename.empty()) wunlink(filename);
+    wcstring index_filename = history_filename(name, L".index");
+    if (!index_filename.empty()) wunlink(index_filename);
     this->clear_file_state();
 }
 
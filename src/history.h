@@ -51,6 +51,55 @@ enum history_search_type_t {
 
 typedef uint32_t history_identifier_t;
 
+/// A compact summary of the byte trigrams in a command as it appears in the history file (UTF-8,
+/// YAML escaped). An item can only match a search term if its signature contains every bit of the
+/// term's signature, which lets searches skip most items without decoding them.
+struct history_signature_t {
+    uint64_t bits[2];
+
+    history_signature_t() { bits[0] = bits[1] = 0; }
+
+    void add_trigram(unsigned char a, unsigned char b, unsigned char c);
+
+    bool includes(const history_signature_t &other) const {
+        return (bits[0] & other.bits[0]) == other.bits[0] &&
+               (bits[1] & other.bits[1]) == other.bits[1];
+    }
+
+    /// Computes the signature of a raw (escaped) command from the history file.
+    static history_signature_t for_escaped_command(const char *cmd, size_t len);
+
+    /// Computes the signature that any command matching the given search term must contain.
+    static history_signature_t for_search_term(const wcstring &term, bool case_sensitive);
+};
+
+/// A search term prepared for matching against the raw bytes of a fish 2.0 history file, so that
+/// searches can reject items without decoding them. Items it accepts must still be checked with
+/// history_item_t::matches_search.
+class history_raw_matcher_t {
+    // The term encoded as it would be in the history file, before YAML escaping.
+    std::string narrow_term;
+    // The signature that any matching item must include.
+    history_signature_t signature;
+    enum history_search_type_t search_type;
+    bool case_sensitive;
+    // Whether the term is entirely ASCII. Case insensitive matching on raw bytes requires this.
+    bool term_is_ascii;
+
+   public:
+    history_raw_matcher_t();
+    history_raw_matcher_t(const wcstring &term, enum history_search_type_t type,
+                          bool case_sensitive);
+
+    /// Returns false if an item with the given signature certainly does not match.
+    bool signature_may_match(const history_signature_t &sig) const {
+        return sig.includes(signature);
+    }
+
+    /// Returns false if an item with the given raw (YAML escaped) command certainly does not match.
+    bool command_may_match(const char *escaped_cmd, size_t len) const;
+};
+
 class history_item_t {
     friend class history_t;
     friend class history_tests_t;
@@ -166,6 +215,13 @@ class history_t {
     // List of old items, as offsets into out mmap data.
     std::deque<size_t> old_item_offsets;
 
+    // Signatures of old items, parallel to old_item_offsets. Populated from the history index file
+    // where possible, and computed from the mmap'd data otherwise.
+    std::deque<history_signature_t> old_item_signatures;
+
+    // Fills in old_item_signatures.
+    void populate_signatures(void);
+
     // Whether we've loaded old items.
     bool loaded_old;
 
@@ -259,6 +315,10 @@ class history_t {
     // Return the specified history at the specified index. 0 is the index of the current
     // commandline. (So the most recent item is at index 1.)
     history_item_t item_at_index(size_t idx);
+
+    // Returns whether the item at the specified index could match the given search term, without
+    // decoding it. A false return means the item definitely does not match; true means it may.
+    bool item_at_index_may_match(size_t idx, const history_raw_matcher_t &matcher);
 };
 
 class history_search_t {
@@ -269,6 +329,9 @@ class history_search_t {
     // The search term.
     wcstring term;
 
+    // The search term prepared for skipping items that cannot match.
+    history_raw_matcher_t raw_matcher;
+
     // Our search type.
     enum history_search_type_t search_type;
     bool case_sensitive;
@@ -324,6 +387,7 @@ class history_search_t {
                 term.push_back(towlower(*it));
             }
         }
+        raw_matcher = history_raw_matcher_t(term, type, case_sensitive);
     }
 
     // Default constructor.
@@ -305,11 +305,11 @@ void update_fish_color_support(void) {
     if (!fish_term256.missing_or_empty()) {
         support_term256 = from_string<bool>(fish_term256);
         debug(2, L"256 color support determined by 'fish_term256'");
-    } else if (term.find(L"256color") != wcstring::npos) {
+    } else if (term.as_string().find(L"256color") != wcstring::npos) {
         // TERM=*256color*: Explicitly supported.
         support_term256 = true;
         debug(2, L"256 color support enabled for '256color' in TERM");
-    } else if (term.find(L"xterm") != wcstring::npos) {
+    } else if (term.as_string().find(L"xterm") != wcstring::npos) {
         // Assume that all xterms are 256, except for OS X SnowLeopard
         const env_var_t prog = env_get_string(L"TERM_PROGRAM");
         const env_var_t progver = env_get_string(L"TERM_PROGRAM_VERSION");
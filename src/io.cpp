@@ -5,6 +5,7 @@
 #include <errno.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 
 #include "common.h"
@@ -66,6 +67,52 @@ void io_buffer_t::read() {
     }
 }
 
+void io_buffer_t::out_buffer_append(const char *ptr, size_t count) {
+    if (discarded) return;
+    total_size += count;
+    if (read_limit > 0 && total_size > read_limit) {
+        discarded = true;
+        std::vector<char>().swap(out_buffer);
+        wcstring_list_t().swap(completed_lines);
+        return;
+    }
+    if (!split_lines) {
+        out_buffer.insert(out_buffer.end(), ptr, ptr + count);
+        return;
+    }
+
+    // Decode each line as soon as it is complete, so that only the unfinished last line is ever
+    // held as raw bytes. A newline can't be part of a multibyte sequence, so splitting the raw
+    // bytes first is safe.
+    const char *cursor = ptr, *end = ptr + count;
+    const char *stop;
+    while ((stop = (const char *)memchr(cursor, '\n', end - cursor)) != NULL) {
+        if (out_buffer.empty()) {
+            completed_lines.push_back(str2wcstring(cursor, stop - cursor));
+        } else {
+            out_buffer.insert(out_buffer.end(), cursor, stop);
+            completed_lines.push_back(str2wcstring(&out_buffer.at(0), out_buffer.size()));
+            out_buffer.clear();
+        }
+        cursor = stop + 1;
+    }
+    out_buffer.insert(out_buffer.end(), cursor, end);
+}
+
+void io_buffer_t::take_lines(wcstring_list_t *out) {
+    assert(split_lines);
+    if (!out_buffer.empty()) {
+        completed_lines.push_back(str2wcstring(&out_buffer.at(0), out_buffer.size()));
+        out_buffer.clear();
+    }
+    if (out->empty()) {
+        out->swap(completed_lines);
+    } else {
+        out->insert(out->end(), completed_lines.begin(), completed_lines.end());
+    }
+    wcstring_list_t().swap(completed_lines);
+}
+
 bool io_buffer_t::avoid_conflicts_with_io_chain(const io_chain_t &ios) {
     bool result = pipe_avoid_conflicts_with_io_chain(this->pipe_fd, ios);
     if (!result) {
@@ -5,18 +5,6 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <vector>
-// Note that we have to include something to get any _LIBCPP_VERSION defined so we can detect libc++
-// So it's key that vector go above. If we didn't need vector for other reasons, we might include
-// ciso646, which does nothing
-#if defined(_LIBCPP_VERSION) || __cplusplus > 199711L
-// C++11 or libc++ (which is a C++11-only library, but the memory header works OK in C++03)
-#include <memory>
-using std::shared_ptr;
-#else
-// C++03 or libstdc++
-#include <tr1/memory>
-using std::tr1::shared_ptr;
-#endif
 
 #include "common.h"
 
@@ -82,26 +70,50 @@ class io_file_t : public io_data_t {
 
 class io_pipe_t : public io_data_t {
    protected:
-    io_pipe_t(io_mode_t m, int f, bool i) : io_data_t(m, f), is_input(i) {
+    io_pipe_t(io_mode_t m, int f, bool i)
+        : io_data_t(m, f), is_input(i), has_running_reader(false) {
         pipe_fd[0] = pipe_fd[1] = -1;
     }
 
    public:
     int pipe_fd[2];
     const bool is_input;
+    /// Whether the process reading from this pipe is already running. If so, output can be written
+    /// to the pipe directly, since it will be drained instead of filling up and blocking forever.
+    bool has_running_reader;
 
     virtual void print() const;
 
-    io_pipe_t(int f, bool i) : io_data_t(IO_PIPE, f), is_input(i) { pipe_fd[0] = pipe_fd[1] = -1; }
+    io_pipe_t(int f, bool i) : io_data_t(IO_PIPE, f), is_input(i), has_running_reader(false) {
+        pipe_fd[0] = pipe_fd[1] = -1;
+    }
 };
 
 class io_chain_t;
 class io_buffer_t : public io_pipe_t {
    private:
-    /// Buffer to save output in.
+    /// Buffer to save output in. When splitting into lines, this only holds the last, unfinished
+    /// line.
     std::vector<char> out_buffer;
-
-    explicit io_buffer_t(int f) : io_pipe_t(IO_BUFFER, f, false /* not input */), out_buffer() {}
+    /// Whether output is split into lines and decoded as it arrives.
+    bool split_lines;
+    /// The lines decoded so far, when splitting.
+    wcstring_list_t completed_lines;
+    /// The maximum number of bytes to accept, or 0 for no limit.
+    size_t read_limit;
+    /// The number of bytes appended so far.
+    size_t total_size;
+    /// Whether the read limit was exceeded, in which case all output is thrown away.
+    bool discarded;
+
+    explicit io_buffer_t(int f)
+        : io_pipe_t(IO_BUFFER, f, false /* not input */),
+          out_buffer(),
+          split_lines(false),
+          completed_lines(),
+          read_limit(0),
+          total_size(0),
+          discarded(false) {}
 
    public:
     virtual void print() const;
@@ -109,9 +121,22 @@ class io_buffer_t : public io_pipe_t {
     virtual ~io_buffer_t();
 
     /// Function to append to the buffer.
-    void out_buffer_append(const char *ptr, size_t count) {
-        out_buffer.insert(out_buffer.end(), ptr, ptr + count);
-    }
+    void out_buffer_append(const char *ptr, size_t count);
+
+    /// Split output into lines as it arrives instead of keeping it all as raw bytes. Must be called
+    /// before anything is appended.
+    void set_split_lines() { split_lines = true; }
+
+    /// Limit the number of bytes accepted. Once the limit is exceeded, everything appended is
+    /// thrown away, but the pipe is still drained.
+    void set_read_limit(size_t limit) { read_limit = limit; }
+
+    /// Whether output was thrown away because the read limit was exceeded.
+    bool output_discarded() const { return discarded; }
+
+    /// Moves the lines collected when splitting into the given list, followed by any last line
+    /// without a trailing newline.
+    void take_lines(wcstring_list_t *out);
 
     /// Function to get a pointer to the buffer.
     char *out_buffer_ptr(void) { return out_buffer.empty() ? NULL : &out_buffer.at(0); }
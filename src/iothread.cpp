@@ -11,6 +11,8 @@
 #include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <algorithm>
+#include <deque>
 #include <queue>
 
 #include "common.h"
@@ -26,6 +28,10 @@
 #define IO_MAX_THREADS 64
 #endif
 
+/// The smallest number of worker threads in the pool. Requests may block on slow filesystems, so we
+/// want a few workers even on a single processor.
+#define IO_MIN_POOL_SIZE 4
+
 // Values for the wakeup bytes sent to the ioport.
 #define IO_SERVICE_MAIN_THREAD_REQUEST_QUEUE 99
 #define IO_SERVICE_RESULT_QUEUE 100
@@ -38,6 +44,7 @@ struct SpawnRequest_t {
     void (*completionCallback)(void *, int);
     void *context;
     int handlerResult;
+    iothread_cancel_token_t token;
 };
 
 struct MainThreadRequest_t {
@@ -47,11 +54,33 @@ struct MainThreadRequest_t {
     volatile bool done;
 };
 
-// Spawn support. Requests are allocated and come in on request_queue. They go out on result_queue,
-// at which point they can be deallocated. s_active_thread_count is also protected by the lock.
-static pthread_mutex_t s_spawn_queue_lock;
-static std::queue<SpawnRequest_t *> s_request_queue;
-static int s_active_thread_count;
+/// A worker thread's queues of requests, one for each priority. The worker takes the newest request
+/// from its own queues; idle workers steal the oldest ones.
+struct iothread_worker_t {
+    pthread_mutex_t lock;
+    std::deque<SpawnRequest_t *> queues[IOTHREAD_PRIORITY_COUNT];
+};
+
+// Spawn support. Requests are allocated and pushed onto a worker's queue. They go out on
+// result_queue, at which point they can be deallocated.
+static iothread_worker_t s_workers[IO_MAX_THREADS];
+// The number of workers in the pool. Worker threads are started as requests come in, up to this
+// number, and then live forever.
+static int s_pool_size;
+// The main thread puts requests on the workers' queues in turn.
+static unsigned int s_next_worker;
+
+// Protects the counts below, and is used with s_pool_cond to wake up idle workers.
+static pthread_mutex_t s_pool_lock;
+static pthread_cond_t s_pool_cond;
+// The number of worker threads started so far.
+static int s_started_worker_count;
+// The number of workers waiting for a request.
+static int s_idle_worker_count;
+// The number of requests in the queues that no worker has claimed yet.
+static int s_unclaimed_request_count;
+// The number of requests that have not yet finished, including their results being queued.
+static int s_outstanding_request_count;
 
 static pthread_mutex_t s_result_queue_lock;
 static std::queue<SpawnRequest_t *> s_result_queue;
@@ -71,12 +100,20 @@ static void iothread_init(void) {
         inited = true;
 
         // Initialize some locks.
-        VOMIT_ON_FAILURE(pthread_mutex_init(&s_spawn_queue_lock, NULL));
+        VOMIT_ON_FAILURE(pthread_mutex_init(&s_pool_lock, NULL));
+        VOMIT_ON_FAILURE(pthread_cond_init(&s_pool_cond, NULL));
         VOMIT_ON_FAILURE(pthread_mutex_init(&s_result_queue_lock, NULL));
         VOMIT_ON_FAILURE(pthread_mutex_init(&s_main_thread_request_q_lock, NULL));
         VOMIT_ON_FAILURE(pthread_mutex_init(&s_main_thread_performer_lock, NULL));
         VOMIT_ON_FAILURE(pthread_cond_init(&s_main_thread_performer_cond, NULL));
 
+        // Size the pool by the number of processors.
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        s_pool_size = (int)std::min(std::max(cpus, (long)IO_MIN_POOL_SIZE), (long)IO_MAX_THREADS);
+        for (int i = 0; i < s_pool_size; i++) {
+            VOMIT_ON_FAILURE(pthread_mutex_init(&s_workers[i].lock, NULL));
+        }
+
         // Initialize the completion pipes.
         int pipes[2] = {0, 0};
         VOMIT_ON_FAILURE(pipe(pipes));
@@ -90,19 +127,33 @@ static void iothread_init(void) {
     }
 }
 
-static void add_to_queue(struct SpawnRequest_t *req) {
-    ASSERT_IS_LOCKED(s_spawn_queue_lock);
-    s_request_queue.push(req);
-}
-
-static SpawnRequest_t *dequeue_spawn_request(void) {
-    ASSERT_IS_LOCKED(s_spawn_queue_lock);
-    SpawnRequest_t *result = NULL;
-    if (!s_request_queue.empty()) {
-        result = s_request_queue.front();
-        s_request_queue.pop();
+/// Takes a request off the queues, preferring higher priorities. Within a priority, the worker's own
+/// newest request is taken first, and otherwise the oldest one of another worker. The caller must
+/// have claimed a request, which guarantees there is one to find.
+static SpawnRequest_t *iothread_take_request(int self) {
+    for (;;) {
+        for (int priority = 0; priority < IOTHREAD_PRIORITY_COUNT; priority++) {
+            for (int i = 0; i < s_pool_size; i++) {
+                int victim = (self + i) % s_pool_size;
+                iothread_worker_t &worker = s_workers[victim];
+                scoped_lock locker(worker.lock);
+                std::deque<SpawnRequest_t *> &queue = worker.queues[priority];
+                if (queue.empty()) continue;
+
+                SpawnRequest_t *req;
+                if (victim == self) {
+                    req = queue.back();
+                    queue.pop_back();
+                } else {
+                    req = queue.front();
+                    queue.pop_front();
+                }
+                return req;
+            }
+        }
+        // The scan isn't atomic, so requests may have been pushed and taken behind our back. The one
+        // we claimed is still somewhere, so look again.
     }
-    return result;
 }
 
 static void enqueue_thread_result(SpawnRequest_t *req) {
@@ -112,18 +163,26 @@ static void enqueue_thread_result(SpawnRequest_t *req) {
 
 static void *this_thread() { return (void *)(intptr_t)pthread_self(); }
 
-/// The function that does thread work.
-static void *iothread_worker(void *unused) {
-    UNUSED(unused);
-    scoped_lock locker(s_spawn_queue_lock);
-    struct SpawnRequest_t *req;
-    while ((req = dequeue_spawn_request()) != NULL) {
+/// The function that does thread work. Each worker is passed its index in s_workers.
+static void *iothread_worker(void *param) {
+    const int self = (int)(intptr_t)param;
+    for (;;) {
+        // Wait until there is a request nobody has claimed, and claim it.
+        {
+            scoped_lock locker(s_pool_lock);
+            while (s_unclaimed_request_count == 0) {
+                s_idle_worker_count++;
+                VOMIT_ON_FAILURE(pthread_cond_wait(&s_pool_cond, &s_pool_lock));
+                s_idle_worker_count--;
+            }
+            s_unclaimed_request_count--;
+        }
+
+        SpawnRequest_t *req = iothread_take_request(self);
         debug(5, "pthread %p dequeued %p\n", this_thread(), req);
-        // Unlock the queue while we execute the request.
-        locker.unlock();
 
-        // Perform the work.
-        req->handlerResult = req->handler(req->context);
+        // Perform the work, unless the request was cancelled while it waited.
+        req->handlerResult = req->token.cancelled() ? 0 : req->handler(req->context);
 
         // If there's a completion handler, we have to enqueue it on the result queue. Otherwise, we
         // can just delete the request!
@@ -136,28 +195,14 @@ static void *iothread_worker(void *unused) {
             VOMIT_ON_FAILURE(!write_loop(s_write_pipe, &wakeup_byte, sizeof wakeup_byte));
         }
 
-        // Lock us up again.
-        locker.lock();
+        scoped_lock locker(s_pool_lock);
+        assert(s_outstanding_request_count > 0);
+        s_outstanding_request_count--;
     }
-
-    // We believe we have exhausted the thread request queue. We want to decrement
-    // s_active_thread_count and exit. But it's possible that a request just came in. Furthermore,
-    // it's possible that the main thread saw that s_active_thread_count is full, and decided to not
-    // spawn a new thread, trusting in one of the existing threads to handle it. But we've already
-    // committed to not handling anything else. Therefore, we have to decrement
-    // s_active_thread_count under the lock, which we still hold. Likewise, the main thread must
-    // check the value under the lock.
-    ASSERT_IS_LOCKED(s_spawn_queue_lock);
-    assert(s_active_thread_count > 0);
-    s_active_thread_count -= 1;
-
-    debug(5, "pthread %p exiting\n", this_thread());
-    // We're done.
     return NULL;
 }
 
-/// Spawn another thread. No lock is held when this is called.
-static void iothread_spawn() {
+bool iothread_spawn_detached(void *(*func)(void *), void *param) {
     // The spawned thread inherits our signal mask. We don't want the thread to ever receive signals
     // on the spawned thread, so temporarily block all signals, spawn the thread, and then restore
     // it.
@@ -165,52 +210,66 @@ static void iothread_spawn() {
     sigfillset(&new_set);
     VOMIT_ON_FAILURE(pthread_sigmask(SIG_BLOCK, &new_set, &saved_set));
 
-    // Spawn a thread. If this fails, it means there's already a bunch of threads; it is very
-    // unlikely that they are all on the verge of exiting, so one is likely to be ready to handle
-    // extant requests. So we can ignore failure with some confidence.
     pthread_t thread = 0;
-    pthread_create(&thread, NULL, iothread_worker, NULL);
-
-    // We will never join this thread.
-    VOMIT_ON_FAILURE(pthread_detach(thread));
-    debug(5, "pthread %p spawned\n", (void *)(intptr_t)thread);
+    bool spawned = (pthread_create(&thread, NULL, func, param) == 0);
+    if (spawned) {
+        // We will never join this thread.
+        VOMIT_ON_FAILURE(pthread_detach(thread));
+        debug(5, "pthread %p spawned\n", (void *)(intptr_t)thread);
+    }
     // Restore our sigmask.
     VOMIT_ON_FAILURE(pthread_sigmask(SIG_SETMASK, &saved_set, NULL));
+    return spawned;
+}
+
+/// Start the worker with the given index. No lock is held when this is called. If this fails, the
+/// requests will be handled by the workers we already have.
+static void iothread_spawn(int index) {
+    iothread_spawn_detached(iothread_worker, (void *)(intptr_t)index);
 }
 
 int iothread_perform_base(int (*handler)(void *), void (*completionCallback)(void *, int),
-                          void *context) {
+                          void *context, iothread_priority_t priority,
+                          const iothread_cancel_token_t &token) {
     ASSERT_IS_MAIN_THREAD();
     ASSERT_IS_NOT_FORKED_CHILD();
     iothread_init();
+    assert(priority >= 0 && priority < IOTHREAD_PRIORITY_COUNT);
 
     // Create and initialize a request.
     struct SpawnRequest_t *req = new SpawnRequest_t();
     req->handler = handler;
     req->completionCallback = completionCallback;
     req->context = context;
+    req->token = token;
 
-    int local_thread_count = -1;
-    bool spawn_new_thread = false;
+    // Start another worker if none are idle and the pool isn't full yet.
+    int spawn_index = -1;
+    int worker_count;
     {
-        // Lock around a local region. Note that we can only access s_active_thread_count under the
-        // lock.
-        scoped_lock locker(s_spawn_queue_lock);
-        add_to_queue(req);
-        if (s_active_thread_count < IO_MAX_THREADS) {
-            s_active_thread_count++;
-            spawn_new_thread = true;
+        scoped_lock locker(s_pool_lock);
+        if (s_idle_worker_count == 0 && s_started_worker_count < s_pool_size) {
+            spawn_index = s_started_worker_count++;
         }
-        local_thread_count = s_active_thread_count;
+        worker_count = s_started_worker_count;
     }
 
-    // Kick off the thread if we decided to do so.
-    if (spawn_new_thread) {
-        iothread_spawn();
+    // Put the request on the queue of the next worker in turn. It must be visible there before it
+    // is counted as unclaimed, so that whoever claims it is sure to find it.
+    iothread_worker_t &worker = s_workers[s_next_worker++ % worker_count];
+    {
+        scoped_lock locker(worker.lock);
+        worker.queues[priority].push_back(req);
+    }
+    {
+        scoped_lock locker(s_pool_lock);
+        s_unclaimed_request_count++;
+        s_outstanding_request_count++;
+        if (s_idle_worker_count > 0) VOMIT_ON_FAILURE(pthread_cond_signal(&s_pool_cond));
     }
 
-    // We return the active thread count for informational purposes only.
-    return local_thread_count;
+    if (spawn_index >= 0) iothread_spawn(spawn_index);
+    return worker_count;
 }
 
 int iothread_port(void) {
@@ -245,29 +304,23 @@ static bool iothread_wait_for_pending_completions(long timeout_usec) {
     return ret > 0;
 }
 
-/// Note that this function is quite sketchy. In particular, it drains threads, not requests,
-/// meaning that it may leave requests on the queue. This is the desired behavior (it may be called
-/// before fork, and we don't want to bother servicing requests before we fork), but in the test
-/// suite we depend on it draining all requests. In practice, this works, because a thread in
-/// practice won't exit while there is outstanding requests.
-///
-/// At the moment, this function is only used in the test suite and in a
-/// drain-all-threads-before-fork compatibility mode that no architecture requires, so it's OK that
-/// it's terrible.
+/// Waits until every request has been performed, servicing completions in the meantime. It may be
+/// called before fork, and in the test suite.
 void iothread_drain_all(void) {
     ASSERT_IS_MAIN_THREAD();
     ASSERT_IS_NOT_FORKED_CHILD();
+    iothread_init();
 
-    scoped_lock locker(s_spawn_queue_lock);
+    scoped_lock locker(s_pool_lock);
 
 #define TIME_DRAIN 0
 #if TIME_DRAIN
-    int thread_count = s_active_thread_count;
+    int request_count = s_outstanding_request_count;
     double now = timef();
 #endif
 
     // Nasty polling via select().
-    while (s_active_thread_count > 0) {
+    while (s_outstanding_request_count > 0) {
         locker.unlock();
         if (iothread_wait_for_pending_completions(1000)) {
             iothread_service_completion();
@@ -276,7 +329,8 @@ void iothread_drain_all(void) {
     }
 #if TIME_DRAIN
     double after = timef();
-    printf("(Waited %.02f msec for %d thread(s) to drain)\n", 1000 * (after - now), thread_count);
+    printf("(Waited %.02f msec for %d request(s) to drain)\n", 1000 * (after - now),
+           request_count);
 #endif
 }
 
@@ -2,6 +2,31 @@
 #ifndef FISH_IOTHREAD_H
 #define FISH_IOTHREAD_H
 
+/// Priorities of requests. Requests of a higher priority are started before any of a lower one.
+enum iothread_priority_t {
+    /// Work the user is waiting on, like highlighting and autosuggestions.
+    IOTHREAD_PRIORITY_INTERACTIVE,
+    /// Everything else.
+    IOTHREAD_PRIORITY_NORMAL,
+    IOTHREAD_PRIORITY_COUNT
+};
+
+/// Lets a request be cancelled before it starts. The token remembers the value of a counter, such
+/// as the reader's generation count, and the request is cancelled once the counter has changed.
+struct iothread_cancel_token_t {
+    const volatile unsigned int *counter;
+    unsigned int generation;
+
+    /// A token that is never cancelled.
+    iothread_cancel_token_t() : counter(NULL), generation(0) {}
+
+    /// A token that is cancelled once the given counter changes from its current value.
+    explicit iothread_cancel_token_t(const volatile unsigned int *c)
+        : counter(c), generation(*c) {}
+
+    bool cancelled() const { return counter != NULL && *counter != generation; }
+};
+
 /// Runs a command on a thread.
 ///
 /// \param handler The function to execute on a background thread. Accepts an arbitrary context
@@ -9,9 +34,13 @@
 /// \param completionCallback The function to execute on the main thread once the background thread
 /// is complete. Accepts an int (the return value of handler) and the context.
 /// \param context A arbitary context pointer to pass to the handler and completion callback.
-/// \return A sequence number, currently not very useful.
+/// \param priority The priority of the request.
+/// \param token If this is cancelled before the request starts, the handler is not run and the
+/// completion callback is passed 0.
+/// \return The number of worker threads, for informational purposes only.
 int iothread_perform_base(int (*handler)(void *), void (*completionCallback)(void *, int),
-                          void *context);
+                          void *context, iothread_priority_t priority = IOTHREAD_PRIORITY_NORMAL,
+                          const iothread_cancel_token_t &token = iothread_cancel_token_t());
 
 /// Gets the fd on which to listen for completion callbacks.
 ///
@@ -21,12 +50,17 @@ int iothread_port(void);
 /// Services one iothread competion callback.
 void iothread_service_completion(void);
 
-/// Waits for all iothreads to terminate.
+/// Waits for all requests to complete.
 void iothread_drain_all(void);
 
 /// Performs a function on the main thread, blocking until it completes.
 int iothread_perform_on_main_base(int (*handler)(void *), void *context);
 
+/// Runs a function on a new thread of its own, for work that may block for a long time and so
+/// shouldn't hold up the requests of the pool. The thread is detached and runs with all signals
+/// blocked. Returns false if the thread could not be created.
+bool iothread_spawn_detached(void *(*func)(void *), void *param);
+
 /// Helper templates.
 template <typename T>
 int iothread_perform(int (*handler)(T *), void (*completionCallback)(T *, int), T *context) {
@@ -35,6 +69,15 @@ int iothread_perform(int (*handler)(T *), void (*completionCallback)(T *, int),
                                  static_cast<void *>(context));
 }
 
+// Variant that takes a priority and a cancellation token.
+template <typename T>
+int iothread_perform(int (*handler)(T *), void (*completionCallback)(T *, int), T *context,
+                     iothread_priority_t priority, const iothread_cancel_token_t &token) {
+    return iothread_perform_base((int (*)(void *))handler,
+                                 (void (*)(void *, int))completionCallback,
+                                 static_cast<void *>(context), priority, token);
+}
+
 // Variant that takes no completion callback.
 template <typename T>
 int iothread_perform(int (*handler)(T *), T *context) {
@@ -75,10 +75,11 @@ static wcstring profiling_cmd_name_for_redirectable_block(const parse_node_t &no
     return result;
 }
 
-parse_execution_context_t::parse_execution_context_t(moved_ref<parse_node_tree_t> t,
+parse_execution_context_t::parse_execution_context_t(const parsed_tree_ref_t &t,
                                                      const wcstring &s, parser_t *p,
                                                      int initial_eval_level)
-    : tree(t),
+    : tree_ref(t),
+      tree(*t),
       src(s),
       parser(p),
       eval_level(initial_eval_level),
@@ -483,7 +484,9 @@ parse_execution_result_t parse_execution_context_t::run_for_statement(
         }
 
         const wcstring &val = argument_sequence.at(i);
-        env_set(for_var_name, val.c_str(), ENV_LOCAL);
+        if (!env_set_loop_var(for_var_name, val)) {
+            env_set(for_var_name, val.c_str(), ENV_LOCAL);
+        }
         fb->loop_status = LOOP_NORMAL;
         fb->skip = 0;
 
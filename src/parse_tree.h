@@ -224,6 +224,10 @@ class parse_node_tree_t : public std::vector<parse_node_t> {
     bool job_should_be_backgrounded(const parse_node_t &job) const;
 };
 
+/// A shared, immutable parse tree. This allows a tree to be parsed once and executed many times,
+/// e.g. for function bodies.
+typedef shared_ptr<const parse_node_tree_t> parsed_tree_ref_t;
+
 /// The big entry point. Parse a string, attempting to produce a tree for the given goal type.
 bool parse_tree_from_string(const wcstring &str, parse_tree_flags_t flags,
                             parse_node_tree_t *output, parse_error_list_t *errors,
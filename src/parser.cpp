@@ -624,10 +624,19 @@ int parser_t::eval(const wcstring &cmd, const io_chain_t &io, enum block_type_t
 
 int parser_t::eval_acquiring_tree(const wcstring &cmd, const io_chain_t &io,
                                   enum block_type_t block_type, moved_ref<parse_node_tree_t> tree) {
+    if (tree.val.empty()) {
+        return 0;
+    }
+    return this->eval_parsed_tree(cmd, io, block_type,
+                                  parsed_tree_ref_t(new parse_node_tree_t(tree)));
+}
+
+int parser_t::eval_parsed_tree(const wcstring &cmd, const io_chain_t &io,
+                               enum block_type_t block_type, const parsed_tree_ref_t &tree) {
     CHECK_BLOCK(1);
     assert(block_type == TOP || block_type == SUBST);
 
-    if (tree.val.empty()) {
+    if (!tree || tree->empty()) {
         return 0;
     }
 
@@ -205,9 +205,6 @@ class parser_t {
     parser_t(const parser_t &);
     parser_t &operator=(const parser_t &);
 
-    /// Adds a job to the beginning of the job list.
-    void job_add(job_t *job);
-
     /// Returns the name of the currently evaluated function if we are currently evaluating a
     /// function, null otherwise. This is tested by moving down the block-scope-stack, checking
     /// every block if it is of type FUNCTION_CALL.
@@ -220,6 +217,9 @@ class parser_t {
     /// Get the "principal" parser, whatever that is.
     static parser_t &principal_parser();
 
+    /// Adds a job to the beginning of the job list.
+    void job_add(job_t *job);
+
     /// Indicates that execution of all blocks in the principal parser should stop. This is called
     /// from signal handlers!
     static void skip_all_blocks();
@@ -244,6 +244,11 @@ class parser_t {
     int eval_acquiring_tree(const wcstring &cmd, const io_chain_t &io, enum block_type_t block_type,
                             moved_ref<parse_node_tree_t> t);
 
+    /// Evaluate the expressions contained in cmd, which has already been parsed into the given
+    /// shared tree. The tree is not modified, so it may be cached and evaluated again later.
+    int eval_parsed_tree(const wcstring &cmd, const io_chain_t &io, enum block_type_t block_type,
+                         const parsed_tree_ref_t &tree);
+
     /// Evaluates a block node at the given node offset in the topmost execution context.
     int eval_block_node(node_offset_t node_idx, const io_chain_t &io, enum block_type_t block_type);
 
@@ -5,10 +5,13 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <pthread.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <wchar.h>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common.h"
@@ -21,8 +24,16 @@
 /// Unexpected error in path_get_path().
 #define MISSING_COMMAND_ERR_MSG _(L"Error while searching for command '%ls'")
 
-static bool path_get_path_core(const wcstring &cmd, wcstring *out_path,
-                               const env_var_t &bin_path_var) {
+/// Returns the value of PATH to search, substituting the default if it is missing.
+static wcstring path_get_bin_path(const env_var_t &bin_path_var) {
+    if (!bin_path_var.missing()) return bin_path_var;
+    if (contains(PREFIX L"/bin", L"/bin", L"/usr/bin")) {
+        return L"/bin" ARRAY_SEP_STR L"/usr/bin";
+    }
+    return L"/bin" ARRAY_SEP_STR L"/usr/bin" ARRAY_SEP_STR PREFIX L"/bin";
+}
+
+static bool path_get_path_core(const wcstring &cmd, wcstring *out_path, const wcstring &bin_path) {
     int err = ENOENT;
     debug(3, L"path_get_path( '%ls' )", cmd.c_str());
 
@@ -44,17 +55,6 @@ static bool path_get_path_core(const wcstring &cmd, wcstring *out_path,
         return false;
     }
 
-    wcstring bin_path;
-    if (!bin_path_var.missing()) {
-        bin_path = bin_path_var;
-    } else {
-        if (contains(PREFIX L"/bin", L"/bin", L"/usr/bin")) {
-            bin_path = L"/bin" ARRAY_SEP_STR L"/usr/bin";
-        } else {
-            bin_path = L"/bin" ARRAY_SEP_STR L"/usr/bin" ARRAY_SEP_STR PREFIX L"/bin";
-        }
-    }
-
     wcstring nxt_path;
     wcstokenizer tokenizer(bin_path, ARRAY_SEP_STR);
     while (tokenizer.next(nxt_path)) {
@@ -94,12 +94,164 @@ static bool path_get_path_core(const wcstring &cmd, wcstring *out_path,
     return false;
 }
 
+/// How often, in seconds, the directories in PATH are checked for changes. The command cache is
+/// flushed whenever one of them has changed.
+#define PATH_CACHE_RECHECK_INTERVAL 1.0
+
+/// The cached result of looking up a command in PATH.
+struct path_cache_entry_t {
+    /// The full path of the command, or empty if it was not found.
+    wcstring path;
+    /// The errno value of a failed lookup.
+    int err;
+    /// The number of times the entry was used.
+    unsigned long hits;
+
+    path_cache_entry_t() : path(), err(0), hits(0) {}
+};
+
+/// Cache of the locations of commands, like the hash table of other shells. The cache is only valid
+/// for one value of PATH, and for as long as none of the directories in it have changed.
+struct path_cache_t {
+    /// The value of PATH the cache was made for.
+    wcstring bin_path;
+    /// The directories in PATH, with their identity when they were last checked.
+    std::vector<std::pair<wcstring, file_id_t> > dirs;
+    /// When the directories were last checked.
+    double last_checked;
+    /// Whether lookups can be cached. They can't if PATH contains relative directories.
+    bool cacheable;
+    /// The commands looked up so far.
+    std::map<wcstring, path_cache_entry_t> entries;
+
+    path_cache_t() : bin_path(), dirs(), last_checked(0), cacheable(false), entries() {}
+};
+
+static pthread_mutex_t path_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static path_cache_t path_cache;
+
+/// Makes sure the cache matches the given PATH and the current state of its directories, flushing
+/// it otherwise. Returns false if lookups in this PATH can't be cached, because it contains
+/// relative directories. The cache lock must be held.
+static bool path_cache_validate(const wcstring &bin_path) {
+    ASSERT_IS_LOCKED(path_cache_lock);
+    double now = timef();
+    if (bin_path == path_cache.bin_path) {
+        if (now - path_cache.last_checked < PATH_CACHE_RECHECK_INTERVAL) {
+            return path_cache.cacheable;
+        }
+
+        bool changed = false;
+        for (size_t i = 0; i < path_cache.dirs.size() && !changed; i++) {
+            changed = file_id_for_path(path_cache.dirs[i].first) != path_cache.dirs[i].second;
+        }
+        path_cache.last_checked = now;
+        if (!changed) return path_cache.cacheable;
+    }
+
+    path_cache.bin_path = bin_path;
+    path_cache.dirs.clear();
+    path_cache.entries.clear();
+    path_cache.last_checked = now;
+    path_cache.cacheable = true;
+
+    wcstring dir;
+    wcstokenizer tokenizer(bin_path, ARRAY_SEP_STR);
+    while (tokenizer.next(dir)) {
+        if (dir.empty()) continue;
+        if (dir.at(0) != L'/') {
+            path_cache.dirs.clear();
+            path_cache.cacheable = false;
+            break;
+        }
+        path_cache.dirs.push_back(std::make_pair(dir, file_id_for_path(dir)));
+    }
+    return path_cache.cacheable;
+}
+
+/// Looks up a command, using the cache if possible. A found command is checked to still be
+/// executable before it is returned. A command that was not found is searched for again unless
+/// \p trust_misses is set, since it may just have been installed.
+static bool path_lookup(const wcstring &cmd, wcstring *out_path, const env_var_t &bin_path_var,
+                        bool trust_misses) {
+    const wcstring bin_path = path_get_bin_path(bin_path_var);
+
+    // Paths are not looked up in PATH, so there is nothing to cache.
+    if (cmd.find(L'/') != wcstring::npos) {
+        return path_get_path_core(cmd, out_path, bin_path);
+    }
+
+    {
+        scoped_lock locker(path_cache_lock);
+        if (!path_cache_validate(bin_path)) {
+            return path_get_path_core(cmd, out_path, bin_path);
+        }
+
+        std::map<wcstring, path_cache_entry_t>::iterator iter = path_cache.entries.find(cmd);
+        if (iter != path_cache.entries.end()) {
+            path_cache_entry_t &entry = iter->second;
+            if (entry.path.empty()) {
+                if (trust_misses) {
+                    errno = entry.err;
+                    return false;
+                }
+            } else if (waccess(entry.path, X_OK) == 0) {
+                entry.hits++;
+                if (out_path) out_path->assign(entry.path);
+                return true;
+            }
+        }
+    }
+
+    // Search outside the lock, since this may be slow.
+    wcstring path;
+    bool found = path_get_path_core(cmd, &path, bin_path);
+    int err = errno;
+
+    scoped_lock locker(path_cache_lock);
+    if (path_cache.bin_path == bin_path) {
+        path_cache_entry_t &entry = path_cache.entries[cmd];
+        entry.path = found ? path : wcstring();
+        entry.err = found ? 0 : err;
+        entry.hits = found ? 1 : 0;
+    }
+    if (found && out_path) out_path->swap(path);
+    errno = err;
+    return found;
+}
+
 bool path_get_path(const wcstring &cmd, wcstring *out_path, const env_vars_snapshot_t &vars) {
-    return path_get_path_core(cmd, out_path, vars.get(L"PATH"));
+    return path_lookup(cmd, out_path, vars.get(L"PATH"), false);
 }
 
 bool path_get_path(const wcstring &cmd, wcstring *out_path) {
-    return path_get_path_core(cmd, out_path, env_get_string(L"PATH"));
+    return path_lookup(cmd, out_path, env_get_string(L"PATH"), false);
+}
+
+bool path_get_path_cached(const wcstring &cmd, wcstring *out_path,
+                          const env_vars_snapshot_t &vars) {
+    return path_lookup(cmd, out_path, vars.get(L"PATH"), true);
+}
+
+wcstring_list_t path_cache_list(std::vector<unsigned long> *hits) {
+    wcstring_list_t result;
+    scoped_lock locker(path_cache_lock);
+    std::map<wcstring, path_cache_entry_t>::const_iterator iter;
+    for (iter = path_cache.entries.begin(); iter != path_cache.entries.end(); ++iter) {
+        if (iter->second.path.empty()) continue;
+        result.push_back(iter->second.path);
+        if (hits) hits->push_back(iter->second.hits);
+    }
+    return result;
+}
+
+void path_cache_clear() {
+    scoped_lock locker(path_cache_lock);
+    path_cache.bin_path.clear();
+    path_cache.dirs.clear();
+    path_cache.entries.clear();
+    path_cache.last_checked = 0;
+    path_cache.cacheable = false;
 }
 
 bool path_get_cdpath(const wcstring &dir, wcstring *out, const wchar_t *wd,
@@ -219,14 +371,14 @@ static wcstring path_create_config() {
 
     const env_var_t xdg_dir = env_get_string(L"XDG_CONFIG_HOME");
     if (!xdg_dir.missing()) {
-        res = xdg_dir + L"/fish";
+        res = xdg_dir.as_string() + L"/fish";
         if (!create_directory(res)) {
             done = true;
         }
     } else {
         const env_var_t home = env_get_string(L"HOME");
         if (!home.missing()) {
-            res = home + L"/.config/fish";
+            res = home.as_string() + L"/.config/fish";
             if (!create_directory(res)) {
                 done = true;
             }
@@ -249,14 +401,14 @@ static wcstring path_create_data() {
 
     const env_var_t xdg_dir = env_get_string(L"XDG_DATA_HOME");
     if (!xdg_dir.missing()) {
-        res = xdg_dir + L"/fish";
+        res = xdg_dir.as_string() + L"/fish";
         if (!create_directory(res)) {
             done = true;
         }
     } else {
         const env_var_t home = env_get_string(L"HOME");
         if (!home.missing()) {
-            res = home + L"/.local/share/fish";
+            res = home.as_string() + L"/.local/share/fish";
             if (!create_directory(res)) {
                 done = true;
             }
@@ -5,6 +5,7 @@
 #define FISH_PATH_H
 
 #include <stddef.h>
+#include <vector>
 
 #include "common.h"
 #include "env.h"
@@ -29,7 +30,8 @@ bool path_get_config(wcstring &path);
 /// \return whether the directory was returned successfully
 bool path_get_data(wcstring &path);
 
-/// Finds the full path of an executable. Returns YES if successful.
+/// Finds the full path of an executable. Returns YES if successful. Locations are cached for as long
+/// as PATH and its directories are unchanged.
 ///
 /// \param cmd The name of the executable.
 /// \param output_or_NULL If non-NULL, store the full path.
@@ -39,6 +41,19 @@ bool path_get_data(wcstring &path);
 bool path_get_path(const wcstring &cmd, wcstring *output_or_NULL,
                    const env_vars_snapshot_t &vars = env_vars_snapshot_t::current());
 
+/// Like path_get_path, but a command that was recently found missing is assumed to still be missing
+/// instead of being searched for again. The answer may be out of date by up to a second, which is
+/// fine for highlighting and completions but not for running commands.
+bool path_get_path_cached(const wcstring &cmd, wcstring *output_or_NULL,
+                          const env_vars_snapshot_t &vars = env_vars_snapshot_t::current());
+
+/// Returns the full paths of the commands in the command location cache. If \p hits is not NULL,
+/// the number of times each one was used is stored there.
+wcstring_list_t path_cache_list(std::vector<unsigned long> *hits = NULL);
+
+/// Forget all cached command locations.
+void path_cache_clear();
+
 /// Returns the full path of the specified directory, using the CDPATH variable as a list of base
 /// directories for relative paths. The returned string is allocated using halloc and the specified
 /// context.
@@ -112,6 +112,24 @@ int set_child_group(job_t *j, process_t *p, int print_errors) {
     return res;
 }
 
+int open_redirection_file(const io_file_t *io_file) {
+    int fd = open(io_file->filename_cstr, io_file->flags, OPEN_MASK);
+    if (fd < 0) {
+        if ((io_file->flags & O_EXCL) && (errno == EEXIST)) {
+            debug_safe(1, NOCLOB_ERROR, io_file->filename_cstr);
+        } else {
+            debug_safe(1, FILE_ERROR, io_file->filename_cstr);
+            safe_perror("open");
+        }
+    }
+    return fd;
+}
+
+void report_redirection_error(int fd) {
+    debug_safe_int(1, FD_ERROR, fd);
+    safe_perror("dup2");
+}
+
 /// Set up a childs io redirections. Should only be called by setup_child_process(). Does the
 /// following: First it closes any open file descriptors not related to the child by calling
 /// close_unused_internal_pipes() and closing the universal variable server file descriptor. It then
@@ -140,24 +158,15 @@ static int handle_child_io(const io_chain_t &io_chain) {
 
             case IO_FILE: {
                 // Here we definitely do not want to set CLO_EXEC because our child needs access.
-                const io_file_t *io_file = static_cast<const io_file_t *>(io);
-                int tmp = open(io_file->filename_cstr, io_file->flags, OPEN_MASK);
+                int tmp = open_redirection_file(static_cast<const io_file_t *>(io));
                 if (tmp < 0) {
-                    if ((io_file->flags & O_EXCL) && (errno == EEXIST)) {
-                        debug_safe(1, NOCLOB_ERROR, io_file->filename_cstr);
-                    } else {
-                        debug_safe(1, FILE_ERROR, io_file->filename_cstr);
-                        safe_perror("open");
-                    }
-
                     return -1;
                 } else if (tmp != io->fd) {
                     // This call will sometimes fail, but that is ok, this is just a precausion.
                     close(io->fd);
 
                     if (dup2(tmp, io->fd) == -1) {
-                        debug_safe_int(1, FD_ERROR, io->fd);
-                        safe_perror("dup2");
+                        report_redirection_error(io->fd);
                         exec_close(tmp);
                         return -1;
                     }
@@ -175,8 +184,7 @@ static int handle_child_io(const io_chain_t &io_chain) {
                 close(io->fd);
 
                 if (dup2(old_fd, io->fd) == -1) {
-                    debug_safe_int(1, FD_ERROR, io->fd);
-                    safe_perror("dup2");
+                    report_redirection_error(io->fd);
                     return -1;
                 }
                 break;
@@ -246,9 +254,11 @@ pid_t execute_fork(bool wait_for_threads_to_die) {
     ASSERT_IS_MAIN_THREAD();
 
     if (wait_for_threads_to_die || JOIN_THREADS_BEFORE_FORK) {
-        // Make sure we have no outstanding threads before we fork. This is a pretty sketchy thing
-        // to do here, both because exec.cpp shouldn't have to know about iothreads, and because the
-        // completion handlers may do unexpected things.
+        // Make sure no iothread requests are running before we fork. The worker threads live for
+        // the life of the process, so this only waits for their requests to finish, not for the
+        // threads to exit. This is a pretty sketchy thing to do here, both because exec.cpp
+        // shouldn't have to know about iothreads, and because the completion handlers may do
+        // unexpected things.
         iothread_drain_all();
     }
 
@@ -328,10 +338,11 @@ bool fork_actions_make_spawn_properties(posix_spawnattr_t *attr,
     if (!err && should_set_parent_group_id)
         err = posix_spawnattr_setpgroup(attr, desired_parent_group_id);
 
-    // Everybody gets default handlers.
+    // Everybody gets default handlers, as in setup_child_process. That includes the signals we
+    // ignore, since ignoring a signal is inherited across exec.
     if (!err && reset_signal_handlers) {
         sigset_t sigdefault;
-        get_signals_with_handlers(&sigdefault);
+        get_signals_to_default(&sigdefault);
         err = posix_spawnattr_setsigdefault(attr, &sigdefault);
     }
 
@@ -379,7 +390,8 @@ bool fork_actions_make_spawn_properties(posix_spawnattr_t *attr,
                 if (!err) err = posix_spawn_file_actions_adddup2(actions, from_fd, to_fd);
 
                 if (write_pipe_idx > 0) {
-                    if (!err) err = posix_spawn_file_actions_addclose(actions, io_pipe->pipe_fd[0]);
+                    if (!err && io_pipe->pipe_fd[0] >= 0)
+                        err = posix_spawn_file_actions_addclose(actions, io_pipe->pipe_fd[0]);
                     if (!err) err = posix_spawn_file_actions_addclose(actions, io_pipe->pipe_fd[1]);
                 } else {
                     if (!err) err = posix_spawn_file_actions_addclose(actions, io_pipe->pipe_fd[0]);
@@ -14,6 +14,7 @@
 #endif
 
 class io_chain_t;
+class io_file_t;
 class job_t;
 class process_t;
 
@@ -40,12 +41,17 @@ int set_child_group(job_t *j, process_t *p, int print_errors);
 /// On failiure, signal handlers, io redirections and process group of the process is undefined.
 int setup_child_process(job_t *j, process_t *p, const io_chain_t &io_chain);
 
-/// Call fork(), optionally waiting until we are no longer multithreaded. If the forked child
+/// Call fork(), optionally waiting until no iothread requests are running. If the forked child
 /// doesn't do anything that could allocate memory, take a lock, etc. (like call exec), then it's
-/// not necessary to wait for threads to die. If the forked child may do those things, it should
-/// wait for threads to die.
+/// not necessary to wait. If the forked child may do those things, it should wait.
 pid_t execute_fork(bool wait_for_threads_to_die);
 
+/// Open the file of a file redirection, printing an error if that fails. Returns the fd, or -1.
+int open_redirection_file(const io_file_t *io_file);
+
+/// Print the error for a redirection to fd that dup2 failed to set up, using errno.
+void report_redirection_error(int fd);
+
 /// Perform output from builtins. Returns true on success.
 bool do_builtin_io(const char *out, size_t outlen, const char *err, size_t errlen);
 
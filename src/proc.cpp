@@ -15,7 +15,9 @@
 #include <unistd.h>
 #include <wchar.h>
 #include <wctype.h>
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 #if HAVE_TERM_H
 #include <term.h>
@@ -125,7 +127,42 @@ static event_t event(0);
 /// proc_pop_interactive.
 static std::vector<int> interactive_stack;
 
-void proc_init() { proc_push_interactive(0); }
+/// A pipe that job_handle_signal writes a byte to on every SIGCHLD, so that waiting for a job can
+/// select on a change in the status of a child along with the job's output. Both ends are
+/// nonblocking, and the pipe may stay full if nobody is waiting.
+static int s_sigchld_pipe[2] = {-1, -1};
+
+/// How long select_try waits without the SIGCHLD pipe, so that finished processes are noticed.
+#define SELECT_TRY_POLL_USEC 10000
+
+/// How long select_try waits with the SIGCHLD pipe. This only bounds the wait if a wakeup is
+/// missed, e.g. because a child's status was left for a later wait.
+#define SELECT_TRY_FALLBACK_USEC 500000
+
+/// The running processes of the jobs in the job list, by pid, so that handle_child_status doesn't
+/// have to walk every process of every job to find the one a status is for. Processes are added
+/// as exec_job launches them, and removed when they complete or their job is freed.
+typedef std::map<pid_t, std::pair<job_t *, process_t *> > process_index_t;
+static process_index_t s_process_index;
+
+/// The jobs that have JOB_STATE_CHANGED set, in the order they changed. job_reap only looks at
+/// these, since no other job can have completed or stopped.
+static std::vector<job_t *> s_changed_jobs;
+
+void proc_init() {
+    proc_push_interactive(0);
+
+    if (pipe(s_sigchld_pipe) == -1) {
+        // We can still wait for jobs, by polling.
+        wperror(L"pipe");
+        s_sigchld_pipe[0] = s_sigchld_pipe[1] = -1;
+        return;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        set_cloexec(s_sigchld_pipe[i]);
+        make_fd_nonblocking(s_sigchld_pipe[i]);
+    }
+}
 
 /// Remove job from list of jobs.
 static int job_remove(job_t *j) {
@@ -141,6 +178,18 @@ void job_promote(job_t *job) {
 /// Remove job from the job list and free all memory associated with it.
 void job_free(job_t *j) {
     job_remove(j);
+
+    for (const process_t *p = j->first_process; p != NULL; p = p->next) {
+        // The pid may have been reused by a process of a later job, so only remove our own entry.
+        process_index_t::iterator where = s_process_index.find(p->pid);
+        if (where != s_process_index.end() && where->second.second == p) {
+            s_process_index.erase(where);
+        }
+    }
+    if (job_get_flag(j, JOB_STATE_CHANGED)) {
+        s_changed_jobs.erase(std::find(s_changed_jobs.begin(), s_changed_jobs.end(), j));
+    }
+
     delete j;
 }
 
@@ -293,29 +342,67 @@ void job_mark_process_as_failed(const job_t *job, process_t *p) {
     }
 }
 
+/// Returns whether a process of the job has stopped because it used the terminal before it was
+/// given to the job. This happens to processes started with posix_spawn, since the terminal can
+/// only be given to them after they are running. A job that has the terminal can't get SIGTTIN or
+/// SIGTTOU, so if the job has it now, the signal was sent before.
+static bool stopped_before_getting_terminal(const job_t *j, int status) {
+    if (!WIFSTOPPED(status) || (WSTOPSIG(status) != SIGTTIN && WSTOPSIG(status) != SIGTTOU)) {
+        return false;
+    }
+    if (!job_get_flag(j, JOB_CONTROL) || !job_get_flag(j, JOB_TERMINAL) ||
+        !job_get_flag(j, JOB_FOREGROUND)) {
+        return false;
+    }
+    return tcgetpgrp(STDIN_FILENO) == j->pgid;
+}
+
+void job_index_process(job_t *j, process_t *p) {
+    ASSERT_IS_MAIN_THREAD();
+    assert(p->pid > 0);
+    s_process_index[p->pid] = std::make_pair(j, p);
+}
+
+void job_mark_changed(job_t *j) {
+    ASSERT_IS_MAIN_THREAD();
+    if (!job_get_flag(j, JOB_STATE_CHANGED)) {
+        job_set_flag(j, JOB_STATE_CHANGED, 1);
+        s_changed_jobs.push_back(j);
+    }
+}
+
 /// Handle status update for child \c pid.
 ///
 /// \param pid the pid of the process whose status changes
 /// \param status the status as returned by wait
 static void handle_child_status(pid_t pid, int status) {
     bool found_proc = false;
-    const job_t *j = NULL;
     process_t *p = NULL;
 
-    job_iterator_t jobs;
-    while (!found_proc && (j = jobs.next())) {
-        process_t *prev = 0;
-        for (p = j->first_process; p; p = p->next) {
-            if (pid == p->pid) {
-                mark_process_status(p, status);
-                if (p->completed && prev && !prev->completed && prev->pid) {
-                    kill(prev->pid, SIGPIPE);
-                }
-                found_proc = true;
-                break;
+    process_index_t::iterator where = s_process_index.find(pid);
+    if (where != s_process_index.end()) {
+        job_t *j = where->second.first;
+        p = where->second.second;
+
+        if (stopped_before_getting_terminal(j, status)) {
+            debug(3, L"Continuing process %d, which stopped before it got the terminal", pid);
+            kill(pid, SIGCONT);
+            return;
+        }
+        mark_process_status(p, status);
+        job_mark_changed(j);
+        if (p->completed) {
+            s_process_index.erase(where);
+
+            process_t *prev = NULL;
+            for (process_t *cursor = j->first_process; cursor != p; cursor = cursor->next) {
+                prev = cursor;
+            }
+            if (prev && !prev->completed && prev->pid) {
+                kill(prev->pid, SIGPIPE);
             }
-            prev = p;
         }
+        found_proc = true;
     }
 
     // If the child process was not killed by a signal or other than SIGINT or SIGQUIT we're done.
@@ -393,11 +480,122 @@ typedef unsigned int process_generation_count_t;
 /// the SIGCHLD signal handler, and therefore does not need atomics or locks.
 static volatile process_generation_count_t s_sigchld_generation_cnt = 0;
 
-/// If we have received a SIGCHLD signal, process any children. If await is false, this returns
-/// immediately if no SIGCHLD has been received. If await is true, this waits for one. Returns true
-/// if something was processed. This returns the number of children processed, or -1 on error.
-static int process_mark_finished_children(bool wants_await) {
+/// Returns whether the job is still being launched and the leader of its process group must not be
+/// reaped yet. The group exists as long as the leader has not been reaped, so the job's remaining
+/// processes can join it even if the leader has exited already.
+static bool job_spares_pgroup_leader(const job_t *j) {
+    return !job_get_flag(j, JOB_CONSTRUCTED) && job_get_flag(j, JOB_CONTROL) && j->pgid != 0;
+}
+
+/// Returns whether the child has exited, without reaping it. If so, status gets the status waitpid
+/// would report for it.
+static bool child_has_exited(pid_t pid, int *status) {
+    siginfo_t info = siginfo_t();
+    if (waitid(P_PID, pid, &info, WEXITED | WNOHANG | WNOWAIT) != 0 || info.si_pid != pid) {
+        return false;
+    }
+    // Build the status in the traditional layout the W* macros decode.
+    if (info.si_code == CLD_EXITED) {
+        *status = (info.si_status & 0xff) << 8;
+    } else {
+        *status = (info.si_status & 0x7f) | (info.si_code == CLD_DUMPED ? 0x80 : 0);
+    }
+    return true;
+}
+
+/// Blocks until job_handle_signal reports a SIGCHLD, without reaping anything. The wait is bounded
+/// the same way as in select_try. Returns false if it was interrupted by another signal.
+static bool wait_for_sigchld() {
+    const process_generation_count_t start_cnt = s_sigchld_generation_cnt;
+    const int sigchld_fd = s_sigchld_pipe[0];
+    fd_set fds;
+    FD_ZERO(&fds);
+    struct timeval tv;
+    tv.tv_sec = 0;
+    tv.tv_usec = SELECT_TRY_POLL_USEC;
+    if (sigchld_fd >= 0) {
+        FD_SET(sigchld_fd, &fds);
+        tv.tv_usec = SELECT_TRY_FALLBACK_USEC;
+    }
+
+    int retval = select(sigchld_fd + 1, &fds, 0, 0, &tv);
+    if (retval < 0) return s_sigchld_generation_cnt != start_cnt;
+    if (retval > 0) {
+        char drain[64];
+        while (read(sigchld_fd, drain, sizeof drain) > 0) {
+        }
+    }
+    return true;
+}
+
+/// Reap the children of the shell, except the process group leaders of jobs that are being
+/// launched. This is used instead of waitpid(-1), which could reap such a leader.
+///
+/// The leader is left as a zombie because a process group only exists until its leader is reaped,
+/// and the rest of the job still has to join it. Its exit is seen with waitid and WNOWAIT (POSIX
+/// XSI, which Linux and the BSDs provide), so that e.g. control-C still cancels the function that
+/// is holding up the launch.
+///
+/// Only the processes of the jobs being launched are waited for one by one. All other children are
+/// reaped with one waitpid per process group: jobs with job control have their own group, and
+/// everything else is in the shell's. If await_job is not NULL and nothing has changed yet, this
+/// blocks until the next SIGCHLD, whichever child it is for, and then looks again. Returns the
+/// number of children processed. Sets got_error if the wait was interrupted by another signal.
+static int reap_sparing_pgroup_leaders(const job_t *await_job, bool *got_error) {
+    std::vector<const job_t *> launching_jobs;
+    std::vector<pid_t> pgroups(1, getpgrp());
+    job_iterator_t jobs;
+    while (const job_t *j = jobs.next()) {
+        if (job_spares_pgroup_leader(j)) {
+            launching_jobs.push_back(j);
+        } else if (job_get_flag(j, JOB_CONTROL) && j->pgid > 0) {
+            pgroups.push_back(j->pgid);
+        }
+    }
+    std::sort(pgroups.begin(), pgroups.end());
+    pgroups.erase(std::unique(pgroups.begin(), pgroups.end()), pgroups.end());
+
+    int processed_count = 0;
+    int status = -1;
+    for (bool waited = false;; waited = true) {
+        for (size_t i = 0; i < launching_jobs.size(); i++) {
+            const job_t *j = launching_jobs.at(i);
+            for (const process_t *p = j->first_process; p; p = p->next) {
+                if (p->pid <= 0 || p->completed) continue;
+                if (p->pid == j->pgid) {
+                    if (child_has_exited(p->pid, &status)) {
+                        handle_child_status(p->pid, status);
+                        processed_count += 1;
+                    }
+                } else if (waitpid(p->pid, &status, WUNTRACED | WNOHANG) == p->pid) {
+                    handle_child_status(p->pid, status);
+                    processed_count += 1;
+                }
+            }
+        }
+        for (size_t i = 0; i < pgroups.size(); i++) {
+            pid_t pid;
+            while ((pid = waitpid(-pgroups.at(i), &status, WUNTRACED | WNOHANG)) > 0) {
+                handle_child_status(pid, status);
+                processed_count += 1;
+            }
+        }
+
+        if (await_job == NULL || processed_count > 0 || waited) break;
+        if (!wait_for_sigchld()) {
+            *got_error = true;
+            break;
+        }
+    }
+    return processed_count;
+}
+
+/// If we have received a SIGCHLD signal, process any children. If await_job is NULL, this returns
+/// immediately if no SIGCHLD has been received, unless check_anyway is set. Otherwise this waits
+/// for a child. This returns the number of children processed, or -1 on error.
+static int process_mark_finished_children(const job_t *await_job, bool check_anyway = false) {
     ASSERT_IS_MAIN_THREAD();
+    const bool wants_await = (await_job != NULL);
 
     // A static value tracking the SIGCHLD gen count at the time we last processed it. When this is
     // different from s_sigchld_generation_cnt, it indicates there may be unreaped processes.
@@ -417,9 +615,27 @@ static int process_mark_finished_children(bool wants_await) {
     // Determine whether we have children to process. Note that we can't reliably use the difference
     // because a single SIGCHLD may be delivered for multiple children - see #1768. Also if we are
     // awaiting, we always process.
-    bool wants_waitpid = wants_await || local_count != s_last_sigchld_generation_cnt;
-
+    bool wants_waitpid =
+        wants_await || check_anyway || local_count != s_last_sigchld_generation_cnt;
+
+    // While a job is being launched, its functions and builtins may run and wait for jobs of their
+    // own. Those waits must not reap the process group leader of the job being launched, even if
+    // it has exited: the job's later processes join its group, which goes away once the leader is
+    // reaped. waitpid(-1) can't leave out one child, so reap_sparing_pgroup_leaders takes over.
+    bool must_spare_leaders = false;
     if (wants_waitpid) {
+        job_iterator_t jobs;
+        while (const job_t *j = jobs.next()) {
+            if (job_spares_pgroup_leader(j)) {
+                must_spare_leaders = true;
+                break;
+            }
+        }
+    }
+
+    if (wants_waitpid && must_spare_leaders) {
+        processed_count = reap_sparing_pgroup_leaders(await_job, &got_error);
+    } else if (wants_waitpid) {
         for (;;) {
             // Call waitpid until we get 0/ECHILD. If we wait, it's only on the first iteration. So
             // we want to set NOHANG (don't wait) unless wants_await is true and this is the first
@@ -451,7 +667,9 @@ static int process_mark_finished_children(bool wants_await) {
     if (got_error) {
         return -1;
     }
-    s_last_sigchld_generation_cnt = local_count;
+    // Leaders we spared may be reaped once their job is launched, even if no SIGCHLD arrives after
+    // that. So keep the SIGCHLD unprocessed until then.
+    if (!must_spare_leaders) s_last_sigchld_generation_cnt = local_count;
     return processed_count;
 }
 
@@ -462,6 +680,15 @@ void job_handle_signal(int signal, siginfo_t *info, void *context) {
     UNUSED(context);
     // This is the only place that this generation count is modified. It's OK if it overflows.
     s_sigchld_generation_cnt += 1;
+
+    // Wake up select_try. If the pipe is full, it is readable anyway.
+    if (s_sigchld_pipe[1] >= 0) {
+        int saved_errno = errno;
+        const char wakeup_byte = 0;
+        ssize_t ignored = write(s_sigchld_pipe[1], &wakeup_byte, sizeof wakeup_byte);
+        UNUSED(ignored);
+        errno = saved_errno;
+    }
 }
 
 /// Given a command like "cat file", truncate it to a reasonable length.
@@ -523,7 +750,6 @@ void proc_fire_event(const wchar_t *msg, int type, pid_t pid, int status) {
 
 int job_reap(bool allow_interactive) {
     ASSERT_IS_MAIN_THREAD();
-    job_t *jnext;
     int found = 0;
 
     // job_reap may fire an event handler, we do not want to call ourselves recursively (to avoid
@@ -538,22 +764,28 @@ int job_reap(bool allow_interactive) {
     // don't try to print in that case (#3222)
     const bool interactive = allow_interactive && cur_term != NULL;
 
-    process_mark_finished_children(false);
+    process_mark_finished_children(NULL);
 
     // Preserve the exit status.
     const int saved_status = proc_get_last_status();
 
     job_iterator_t jobs;
     const size_t job_count = jobs.count();
-    jnext = jobs.next();
-    while (jnext) {
-        job_t *j = jnext;
-        jnext = jobs.next();
+
+    // Take the jobs that changed since the last pass. A job that changes again while we are
+    // looking at it, e.g. because an event handler waits for one of its processes, is marked
+    // anew and looked at in the next pass.
+    std::vector<job_t *> changed_jobs;
+    changed_jobs.swap(s_changed_jobs);
+    for (size_t i = 0; i < changed_jobs.size(); i++) {
+        job_t *j = changed_jobs.at(i);
+        job_set_flag(j, JOB_STATE_CHANGED, 0);
 
         // If we are reaping only jobs who do not need status messages sent to the console, do not
-        // consider reaping jobs that need status messages.
+        // consider reaping jobs that need status messages. Keep them for a later pass.
         if ((!job_get_flag(j, JOB_SKIP_NOTIFICATION)) && (!interactive) &&
             (!job_get_flag(j, JOB_FOREGROUND))) {
+            job_mark_changed(j);
             continue;
         }
 
@@ -708,11 +940,15 @@ void proc_update_jiffies() {
 
 #endif
 
-/// Check if there are buffers associated with the job, and select on them for a while if available.
+/// Check if there are buffers associated with the job, and if so, select on them until one has
+/// output to read or the status of a child process changes. Without the SIGCHLD pipe, the wait is
+/// cut short after 10 ms instead, so that finished processes are noticed. With it, the wait is
+/// still cut short after half a second, so a missed wakeup can't hang the job.
 ///
 /// \param j the job to test
 ///
-/// \return 1 if buffers were available, zero otherwise
+/// \return 1 if buffers were available, 0 if a child may have changed status instead, -1 if the job
+/// has no buffers
 static int select_try(job_t *j) {
     fd_set fds;
     int maxfd = -1;
@@ -733,15 +969,27 @@ static int select_try(job_t *j) {
     }
 
     if (maxfd >= 0) {
-        int retval;
+        const int sigchld_fd = s_sigchld_pipe[0];
         struct timeval tv;
-
         tv.tv_sec = 0;
-        tv.tv_usec = 10000;
+        tv.tv_usec = SELECT_TRY_POLL_USEC;
 
-        retval = select(maxfd + 1, &fds, 0, 0, &tv);
+        if (sigchld_fd >= 0) {
+            FD_SET(sigchld_fd, &fds);
+            maxfd = maxi(maxfd, sigchld_fd);
+            tv.tv_usec = SELECT_TRY_FALLBACK_USEC;
+        }
+
+        int retval = select(maxfd + 1, &fds, 0, 0, &tv);
         if (retval == 0) {
             debug(3, L"select_try hit timeout\n");
+        } else if (retval > 0 && sigchld_fd >= 0 && FD_ISSET(sigchld_fd, &fds)) {
+            // Empty the pipe. SIGCHLDs that arrive from here on write to it again, so none are
+            // missed by the next select.
+            char drain[64];
+            while (read(sigchld_fd, drain, sizeof drain) > 0) {
+            }
+            retval -= 1;
         }
         return retval > 0;
     }
@@ -749,22 +997,18 @@ static int select_try(job_t *j) {
     return -1;
 }
 
-/// Read from descriptors until they are empty.
+/// Read from the descriptors of every buffer of the job until they are empty. A job usually has at
+/// most one buffer, but one run by exec_external_capture has a buffer each for stdout and stderr,
+/// and both must be drained so that the process can't block on either.
 ///
 /// \param j the job to test
 static void read_try(job_t *j) {
-    io_buffer_t *buff = NULL;
-
-    // Find the last buffer, which is the one we want to read from.
     const io_chain_t chain = j->all_io_redirections();
     for (size_t idx = 0; idx < chain.size(); idx++) {
         io_data_t *d = chain.at(idx).get();
-        if (d->io_mode == IO_BUFFER) {
-            buff = static_cast<io_buffer_t *>(d);
-        }
-    }
+        if (d->io_mode != IO_BUFFER) continue;
+        io_buffer_t *buff = static_cast<io_buffer_t *>(d);
 
-    if (buff) {
         debug(3, L"proc::read_try('%ls')\n", j->command_wcstr());
         while (1) {
             char b[BUFFER_SIZE];
@@ -844,6 +1088,7 @@ void job_continue(job_t *j, bool cont) {
     // Put job first in the job list.
     job_promote(j);
     job_set_flag(j, JOB_NOTIFIED, 0);
+    job_mark_changed(j);
 
     CHECK_BLOCK();
 
@@ -889,7 +1134,7 @@ void job_continue(job_t *j, bool cont) {
 
         if (job_get_flag(j, JOB_FOREGROUND)) {
             // Look for finished processes first, to avoid select() if it's already done.
-            process_mark_finished_children(false);
+            process_mark_finished_children(NULL);
 
             // Wait for job to report.
             while (!reader_exit_forced() && !job_is_stopped(j) && !job_is_completed(j)) {
@@ -897,12 +1142,13 @@ void job_continue(job_t *j, bool cont) {
                 switch (select_try(j)) {
                     case 1: {
                         read_try(j);
-                        process_mark_finished_children(false);
+                        process_mark_finished_children(NULL);
                         break;
                     }
                     case 0: {
-                        // No FDs are ready. Look for finished processes.
-                        process_mark_finished_children(false);
+                        // No FDs are ready. Look for finished processes, even if we haven't seen
+                        // a SIGCHLD for them, in case select_try timed out on a missed one.
+                        process_mark_finished_children(NULL, true);
                         break;
                     }
                     case -1: {
@@ -912,7 +1158,7 @@ void job_continue(job_t *j, bool cont) {
                         // jobs.
                         //
                         // This will return early if we get a signal, like SIGHUP.
-                        process_mark_finished_children(true);
+                        process_mark_finished_children(j);
                         break;
                     }
                     default: {
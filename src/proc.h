@@ -29,6 +29,9 @@
 /// The status code use when a wildcard had no matches.
 #define STATUS_UNMATCHED_WILDCARD 124
 
+/// The status code used when a command substitution produced more output than fish_read_limit.
+#define STATUS_READ_TOO_MUCH 122
+
 /// The status code used for normal exit in a  builtin.
 #define STATUS_BUILTIN_OK 0
 
@@ -164,7 +167,9 @@ enum {
     /// Whether the job is under job control.
     JOB_CONTROL = 1 << 5,
     /// Whether the job wants to own the terminal when in the foreground.
-    JOB_TERMINAL = 1 << 6
+    JOB_TERMINAL = 1 << 6,
+    /// Whether the job has changed state since job_reap last looked at it.
+    JOB_STATE_CHANGED = 1 << 7
 };
 
 typedef int job_id_t;
@@ -328,7 +333,15 @@ bool job_is_completed(const job_t *j);
 /// \param cont Whether the function should wait for the job to complete before returning
 void job_continue(job_t *j, bool cont);
 
-/// Notify the user about stopped or terminated jobs. Delete terminated jobs from the job list.
+/// Record that a process of the job was started, so its status changes can be found by pid.
+void job_index_process(job_t *j, process_t *p);
+
+/// Record that the job has changed state, so the next call to job_reap looks at it. Changes in the
+/// status of processes added with job_index_process are recorded automatically.
+void job_mark_changed(job_t *j);
+
+/// Notify the user about stopped or terminated jobs. Delete terminated jobs from the job list. Only
+/// jobs that have changed state since the last call are looked at.
 ///
 /// \param interactive whether interactive jobs should be reaped as well
 int job_reap(bool interactive);
@@ -35,8 +35,11 @@
 #include <assert.h>
 #include <fcntl.h>
 #include <signal.h>
+#include <stdint.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <wchar.h>
+#include <map>
 #include <memory>
 
 #include "color.h"
@@ -47,6 +50,7 @@
 #include "exec.h"
 #include "expand.h"
 #include "fallback.h"  // IWYU pragma: keep
+#include "fish_version.h"
 #include "function.h"
 #include "highlight.h"
 #include "history.h"
@@ -62,6 +66,7 @@
 #include "parse_tree.h"
 #include "parse_util.h"
 #include "parser.h"
+#include "path.h"
 #include "proc.h"
 #include "reader.h"
 #include "sanity.h"
@@ -802,7 +807,12 @@ void reader_init() {
     }
 }
 
-void reader_destroy() { pthread_key_delete(generation_count_key); }
+static void parse_cache_save();
+
+void reader_destroy() {
+    parse_cache_save();
+    pthread_key_delete(generation_count_key);
+}
 
 void restore_term_mode() {
     // Restore the term mode if we own the terminal. It's important we do this before
@@ -1235,7 +1245,9 @@ static void update_autosuggestion(void) {
         const editable_line_t *el = data->active_edit_line();
         autosuggestion_context_t *ctx =
             new autosuggestion_context_t(data->history, el->text, el->position);
-        iothread_perform(threaded_autosuggest, autosuggest_completed, ctx);
+        iothread_perform(threaded_autosuggest, autosuggest_completed, ctx,
+                         IOTHREAD_PRIORITY_INTERACTIVE,
+                         iothread_cancel_token_t(&s_generation_count));
     }
 }
 
@@ -1952,6 +1964,7 @@ void reader_run_command(parser_t &parser, const wcstring &cmd) {
 
     parser.eval(cmd, io_chain_t(), TOP);
     job_reap(1);
+    highlight_cache_clear();
 
     gettimeofday(&time_after, NULL);
     set_env_cmd_duration(&time_after, &time_before);
@@ -2124,7 +2137,7 @@ class background_highlight_context_t {
             highlight_function(string_to_highlight, colors, match_highlight_pos, NULL /* error */,
                                vars);
         }
-        return 0;
+        return 1;
     }
 };
 
@@ -2144,9 +2157,9 @@ static void highlight_search(void) {
 }
 
 static void highlight_complete(background_highlight_context_t *ctx, int result) {
-    UNUSED(result);  // ignored because of the indirect invocation via iothread_perform()
     ASSERT_IS_MAIN_THREAD();
-    if (ctx->string_to_highlight == data->command_line.text) {
+    // A result of 0 means the request went stale before the colors were computed.
+    if (result && ctx->string_to_highlight == data->command_line.text) {
         // The data hasn't changed, so swap in our colors. The colors may not have changed, so do
         // nothing if they have not.
         assert(ctx->colors.size() == data->command_line.size());
@@ -2190,7 +2203,8 @@ static void reader_super_highlight_me_plenty(int match_highlight_pos_adjust, boo
         highlight_complete(ctx, result);
     } else {
         // Highlighting including I/O proceeds in the background.
-        iothread_perform(threaded_highlight, highlight_complete, ctx);
+        iothread_perform(threaded_highlight, highlight_complete, ctx, IOTHREAD_PRIORITY_INTERACTIVE,
+                         iothread_cancel_token_t(&s_generation_count));
     }
     highlight_search();
 
@@ -3290,6 +3304,244 @@ int reader_has_pager_contents() {
     return !data->current_page_rendering.screen_data.empty();
 }
 
+/// The parse cache keeps the parse trees of scripts read by read_ni on disk, so that the scripts run
+/// on every startup are not parsed again by every shell. It is used if the fish_parse_cache
+/// variable is set. Trees are stored by the name of the script, and only used if the file is
+/// unchanged. Only trees without errors are stored, so the error checks are skipped too.
+#define PARSE_CACHE_FILE_NAME L"/parse_cache"
+
+/// Each entry in the cache file is this header, followed by the script name in UTF-8 and then the
+/// nodes of the tree.
+struct parse_cache_header_t {
+    uint64_t name_length;
+    uint64_t device;
+    uint64_t inode;
+    uint64_t size;
+    uint64_t change_seconds;
+    uint64_t change_nanoseconds;
+    uint64_t mod_seconds;
+    uint64_t mod_nanoseconds;
+    uint64_t source_length;
+    uint64_t node_count;
+};
+
+/// A tree in the parse cache. Trees read from the cache file are left there until they are used.
+struct parse_cache_entry_t {
+    file_id_t file_id;
+    size_t source_length;
+    // Where the nodes are in the contents of the cache file, if the tree came from it.
+    size_t node_offset;
+    size_t node_count;
+    // The tree, if it was parsed by this shell.
+    parse_node_tree_t tree;
+};
+typedef std::map<wcstring, parse_cache_entry_t> parse_cache_map_t;
+
+static struct {
+    bool loaded;
+    bool modified;
+    // The contents of the cache file.
+    std::string contents;
+    parse_cache_map_t entries;
+
+    // For --print-startup-timing.
+    double parse_seconds;
+    size_t hits;
+    size_t misses;
+} parse_cache;
+
+/// Returns the first line of the cache file. The layout of the nodes depends on how fish was built,
+/// so a cache written by a different fish is ignored.
+static std::string parse_cache_signature() {
+    char buff[128];
+    snprintf(buff, sizeof buff, "# fish parse cache %s %lu\n", get_fish_version(),
+             (unsigned long)sizeof(parse_node_t));
+    return buff;
+}
+
+static bool parse_cache_path(wcstring *path) {
+    if (!path_get_data(*path)) return false;
+    path->append(PARSE_CACHE_FILE_NAME);
+    return true;
+}
+
+static bool parse_cache_enabled() {
+    return !env_get_string(L"fish_parse_cache").missing_or_empty();
+}
+
+/// Reads the cache file and indexes its entries.
+static void parse_cache_load() {
+    ASSERT_IS_MAIN_THREAD();
+    if (parse_cache.loaded) return;
+    parse_cache.loaded = true;
+
+    wcstring path;
+    if (!parse_cache_path(&path)) return;
+    int fd = wopen_cloexec(path, O_RDONLY);
+    if (fd < 0) return;
+    std::string &contents = parse_cache.contents;
+    char buff[4096];
+    ssize_t amt;
+    while ((amt = read_loop(fd, buff, sizeof buff)) > 0) {
+        contents.append(buff, amt);
+    }
+    close(fd);
+
+    const std::string signature = parse_cache_signature();
+    if (contents.compare(0, signature.size(), signature) != 0) {
+        debug(2, L"Ignoring parse cache written by a different fish");
+        contents.clear();
+        return;
+    }
+
+    size_t cursor = signature.size();
+    while (contents.size() - cursor >= sizeof(parse_cache_header_t)) {
+        parse_cache_header_t header;
+        memcpy(&header, contents.data() + cursor, sizeof header);
+        cursor += sizeof header;
+        size_t remaining = contents.size() - cursor;
+        if (header.name_length > remaining ||
+            header.node_count > (remaining - header.name_length) / sizeof(parse_node_t)) {
+            debug(1, L"Parse cache is truncated");
+            break;
+        }
+
+        const wcstring name = str2wcstring(contents.data() + cursor, header.name_length);
+        cursor += header.name_length;
+        parse_cache_entry_t &entry = parse_cache.entries[name];
+        entry.file_id.device = header.device;
+        entry.file_id.inode = header.inode;
+        entry.file_id.size = header.size;
+        entry.file_id.change_seconds = header.change_seconds;
+        entry.file_id.change_nanoseconds = header.change_nanoseconds;
+        entry.file_id.mod_seconds = header.mod_seconds;
+        entry.file_id.mod_nanoseconds = header.mod_nanoseconds;
+        entry.source_length = header.source_length;
+        entry.node_offset = cursor;
+        entry.node_count = header.node_count;
+        cursor += header.node_count * sizeof(parse_node_t);
+    }
+}
+
+/// Returns whether node is well formed in a tree of the given size, for source of the given length.
+/// This protects us against damaged cache files.
+static bool parse_cache_node_is_valid(const parse_node_t &node, size_t node_count,
+                                      size_t source_length) {
+    if (node.type > LAST_TOKEN_TYPE || node.keyword > parse_keyword_while) return false;
+    if (node.parent != NODE_OFFSET_INVALID && node.parent >= node_count) return false;
+    if (node.child_count > 0 && (node.child_start >= node_count ||
+                                 node.child_count > node_count - node.child_start)) {
+        return false;
+    }
+    if (node.source_start != SOURCE_OFFSET_INVALID &&
+        (node.source_start > source_length ||
+         node.source_length > source_length - node.source_start)) {
+        return false;
+    }
+    return true;
+}
+
+/// Gets the cached tree for the script with the given name, file id and source. Returns false if
+/// there is none.
+static bool parse_cache_get(const wcstring &name, const file_id_t &file_id,
+                            const wcstring &source, parse_node_tree_t *tree) {
+    parse_cache_load();
+    parse_cache_map_t::const_iterator where = parse_cache.entries.find(name);
+    if (where == parse_cache.entries.end()) return false;
+    const parse_cache_entry_t &entry = where->second;
+    if (entry.file_id != file_id || entry.source_length != source.size()) return false;
+
+    if (entry.node_count == 0) {
+        *tree = entry.tree;
+        return true;
+    }
+    tree->clear();
+    tree->reserve(entry.node_count);
+    const char *nodes = parse_cache.contents.data() + entry.node_offset;
+    for (size_t i = 0; i < entry.node_count; i++) {
+        parse_node_t node(token_type_invalid);
+        memcpy(&node, nodes + i * sizeof node, sizeof node);
+        if (!parse_cache_node_is_valid(node, entry.node_count, source.size())) {
+            debug(1, L"Ignoring damaged parse cache entry for '%ls'", name.c_str());
+            tree->clear();
+            return false;
+        }
+        tree->push_back(node);
+    }
+    return true;
+}
+
+/// Adds the tree for the script with the given name, file id and source to the cache.
+static void parse_cache_add(const wcstring &name, const file_id_t &file_id,
+                            const wcstring &source, const parse_node_tree_t &tree) {
+    parse_cache_load();
+    parse_cache_entry_t &entry = parse_cache.entries[name];
+    entry.file_id = file_id;
+    entry.source_length = source.size();
+    entry.node_offset = 0;
+    entry.node_count = 0;
+    entry.tree = tree;
+    parse_cache.modified = true;
+}
+
+/// Writes the cache file, if any trees were added to it. Trees of scripts that have changed or gone
+/// away are dropped.
+static void parse_cache_save() {
+    if (!parse_cache.modified) return;
+    parse_cache.modified = false;
+
+    wcstring path;
+    if (!parse_cache_path(&path)) return;
+    std::string narrow_path = wcs2string(path) + ".XXXXXX";
+    int fd = mkstemp(&narrow_path[0]);
+    if (fd < 0) {
+        debug(1, L"Unable to write the parse cache");
+        return;
+    }
+    set_cloexec(fd);
+
+    std::string out = parse_cache_signature();
+    for (parse_cache_map_t::const_iterator iter = parse_cache.entries.begin();
+         iter != parse_cache.entries.end(); ++iter) {
+        const parse_cache_entry_t &entry = iter->second;
+        if (file_id_for_path(iter->first) != entry.file_id) continue;
+
+        const std::string name = wcs2string(iter->first);
+        parse_cache_header_t header;
+        header.name_length = name.size();
+        header.device = entry.file_id.device;
+        header.inode = entry.file_id.inode;
+        header.size = entry.file_id.size;
+        header.change_seconds = entry.file_id.change_seconds;
+        header.change_nanoseconds = entry.file_id.change_nanoseconds;
+        header.mod_seconds = entry.file_id.mod_seconds;
+        header.mod_nanoseconds = entry.file_id.mod_nanoseconds;
+        header.source_length = entry.source_length;
+        header.node_count = entry.node_count ? entry.node_count : entry.tree.size();
+        out.append((const char *)&header, sizeof header);
+        out.append(name);
+        if (entry.node_count) {
+            out.append(parse_cache.contents, entry.node_offset,
+                       entry.node_count * sizeof(parse_node_t));
+        } else if (!entry.tree.empty()) {
+            out.append((const char *)&entry.tree.at(0), entry.tree.size() * sizeof(parse_node_t));
+        }
+    }
+
+    bool ok = write_loop(fd, out.data(), out.size()) >= 0;
+    ok = close(fd) == 0 && ok;
+    if (!ok || rename(narrow_path.c_str(), wcs2string(path).c_str()) != 0) {
+        debug(1, L"Unable to write the parse cache");
+        unlink(narrow_path.c_str());
+    }
+}
+
+void reader_get_parse_timing(double *seconds, size_t *cached, size_t *parsed) {
+    *seconds = parse_cache.parse_seconds;
+    *cached = parse_cache.hits;
+    *parsed = parse_cache.misses;
+}
+
 /// Read non-interactively.  Read input from stdin without displaying the prompt, using syntax
 /// highlighting. This is used for reading scripts and init files.
 static int read_ni(int fd, const io_chain_t &io) {
@@ -3306,6 +3558,15 @@ static int read_ni(int fd, const io_chain_t &io) {
         return 1;
     }
 
+    // Scripts read from files may have their trees in the parse cache.
+    const wchar_t *filename = reader_current_filename();
+    file_id_t file_id = kInvalidFileID;
+    struct stat buf;
+    if (filename != NULL && fstat(des, &buf) == 0 && S_ISREG(buf.st_mode) &&
+        parse_cache_enabled()) {
+        file_id = file_id_t::file_id_from_stat(&buf);
+    }
+
     in_stream = fdopen(des, "r");
     if (in_stream != 0) {
         while (!feof(in_stream)) {
@@ -3349,7 +3610,20 @@ static int read_ni(int fd, const io_chain_t &io) {
 
         parse_error_list_t errors;
         parse_node_tree_t tree;
-        if (!parse_util_detect_errors(str, &errors, false /* do not accept incomplete */, &tree)) {
+        double parse_start = timef();
+        bool cached = file_id != kInvalidFileID && parse_cache_get(filename, file_id, str, &tree);
+        bool has_errors = false;
+        if (!cached) {
+            has_errors =
+                parse_util_detect_errors(str, &errors, false /* do not accept incomplete */, &tree);
+            if (!has_errors && file_id != kInvalidFileID) {
+                parse_cache_add(filename, file_id, str, tree);
+            }
+        }
+        parse_cache.parse_seconds += timef() - parse_start;
+        (cached ? parse_cache.hits : parse_cache.misses)++;
+
+        if (!has_errors) {
             parser.eval_acquiring_tree(str, io, TOP, moved_ref<parse_node_tree_t>(tree));
         } else {
             wcstring sb;
@@ -57,9 +57,13 @@ void reader_sanity_check();
 /// Initialize the reader.
 void reader_init();
 
-/// Destroy and free resources used by the reader.
+/// Destroy and free resources used by the reader. This writes the parse cache.
 void reader_destroy();
 
+/// Returns the time spent parsing scripts read by reader_read, and how many of them had their parse
+/// tree taken from the parse cache or were parsed.
+void reader_get_parse_timing(double *seconds, size_t *cached, size_t *parsed);
+
 /// Restore the term mode at startup.
 void restore_term_mode();
 
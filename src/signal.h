@@ -35,7 +35,8 @@ void signal_unblock();
 /// Returns true if signals are being blocked.
 bool signal_is_blocked();
 
-/// Returns signals with non-default handlers.
-void get_signals_with_handlers(sigset_t *set);
+/// Returns the signals that signal_reset_handlers sets back to their default action, whether they
+/// are handled or ignored.
+void get_signals_to_default(sigset_t *set);
 
 #endif
@@ -0,0 +1 @@
+set fish_function_path '../test/home/fish/functions' '/root/repo/share/functions'
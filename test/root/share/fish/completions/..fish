@@ -0,0 +1 @@
+complete -c . -x -a "(__fish_complete_suffix .fish)"
@@ -0,0 +1,2 @@
+complete -c als -w atool
+complete -c als -a '(__fish_complete_atool_archive_contents)' -d 'Archive content'
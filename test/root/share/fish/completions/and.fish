@@ -0,0 +1,3 @@
+complete -c and -s h -l help --description 'Display help and exit'
+complete -c and -xa '( __fish_complete_subcommand )'
+
@@ -0,0 +1,3 @@
+
+complete -x -c ant -a "(__fish_complete_ant_targets)"
+
@@ -0,0 +1,4 @@
+#apt-setup
+complete -c apt-setup -a probe --description "Probe a CD"
+complete -c apt-setup -s N --description "Run in non-interactive mode"
+
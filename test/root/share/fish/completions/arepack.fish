@@ -0,0 +1 @@
+complete -c arepack -w atool
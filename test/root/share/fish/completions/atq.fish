@@ -0,0 +1,4 @@
+#atq
+complete -f -c atq -s V --description "Display version and exit"
+complete -f -c atq -s q --description "Use specified queue"
+
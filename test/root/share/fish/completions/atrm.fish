@@ -0,0 +1,2 @@
+#atrm
+complete -f -c atrm -s V --description "Display version and exit"
@@ -0,0 +1,2 @@
+complete -c aunpack -w atool
+complete -c aunpack -a '(__fish_complete_atool_archive_contents)' -d 'Archive content'
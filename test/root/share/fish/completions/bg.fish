@@ -0,0 +1,2 @@
+complete -c bg -x -a "(__fish_complete_job_pids)"
+complete -c bg -s h -l help --description 'Display help and exit'
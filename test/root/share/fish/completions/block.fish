@@ -0,0 +1,5 @@
+
+complete -c block -s h -l help --description 'Display help and exit'
+complete -c block -s e -l erase --description 'Remove the topmost global event block'
+complete -c block -s l -l local --description 'Create a local (automatically erased) event block'
+complete -c block -s g -l global --description 'Create a global (manually erased) event block'
@@ -0,0 +1,13 @@
+complete -c bzcat -x -a "(
+	__fish_complete_suffix .tbz
+	__fish_complete_suffix .tbz2
+)
+"
+
+complete -c bzcat -x -a "(
+	__fish_complete_suffix .bz
+	__fish_complete_suffix .bz2
+)
+"
+
+complete -c bzcat -s s -l small --description "Reduce memory usage"
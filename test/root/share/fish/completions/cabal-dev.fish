@@ -0,0 +1 @@
+complete -c cabal-dev -w cabal
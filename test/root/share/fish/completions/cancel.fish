@@ -0,0 +1,3 @@
+__fish_complete_lpr cancel
+complete -c cancel -s u -d 'Cancel jobs owned by username' -xa '(__fish_complete_users)'
+
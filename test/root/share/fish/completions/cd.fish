@@ -0,0 +1,3 @@
+
+complete -x -c cd -a "(__fish_complete_cd)"
+complete -c cd -s h -l help --description 'Display help and exit'
@@ -0,0 +1 @@
+complete -c colordiff -w diff
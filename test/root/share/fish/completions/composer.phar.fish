@@ -0,0 +1 @@
+complete -c composer.phar --wraps=composer
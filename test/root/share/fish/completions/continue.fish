@@ -0,0 +1,3 @@
+
+complete -c continue -s h -l help --description 'Display help and exit'
+
@@ -0,0 +1,11 @@
+complete -c cut -x
+complete -c cut -s b -l bytes -x --description "Output byte range"
+complete -c cut -s c -l characters -x --description "Output character range"
+complete -c cut -s d -l delimiter -x --description "Select field delimiter"
+complete -c cut -s d -l fields -x --description "Select fields"
+complete -c cut -s n --description "Don't split multi byte characters"
+complete -c cut -s s -l only-delimited --description "Do not print lines without delimiter"
+complete -c cut -l output-delimiter --description "Select output delimiter"
+complete -c cut -l help --description "Display help and exit"
+complete -c cut -l version --description "Display version and exit"
+
@@ -0,0 +1,3 @@
+complete -c dvipdf -x -a "(
+           __fish_complete_suffix .dvi
+   )"
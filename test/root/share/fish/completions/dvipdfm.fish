@@ -0,0 +1,4 @@
+complete -c dvipdfm -x -a "
+(
+           __fish_complete_suffix .dvi
+)"
@@ -0,0 +1,6 @@
+complete -c echo -s n --description "Do not output a newline"
+complete -c echo -s s --description "Do not separate arguments with spaces"
+complete -c echo -s E --description "Disable backslash escapes"
+complete -c echo -s e --description "Enable backslash escapes"
+complete -c echo -s h -l help --description "Display help and exit"
+complete -c echo -u
@@ -0,0 +1,4 @@
+
+complete -c exit -s h -l help --description 'Display help and exit'
+complete -c exit -x -a 0 -d "Quit with normal exit status"
+complete -c exit -x -a 1 -d "Quit with abnormal exit status"
@@ -0,0 +1 @@
+complete -c fluxbox-remote -xa '(fluxbox -list-commands)'
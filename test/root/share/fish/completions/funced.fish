@@ -0,0 +1,3 @@
+complete -c funced -xa "(functions -na)" --description "Save function"
+complete -c funced -s e -l editor -d 'Open function in external editor' -xa '(__fish_complete_command)'
+complete -c funced -s i -l interactive -d 'Edit in interactive mode'
@@ -0,0 +1,12 @@
+#
+# Command specific completions for the groupadd command.
+# These completions where generated from the commands
+# man page by the make_completions.py script, but may
+# have been hand edited since.
+#
+
+complete -c groupadd -s f --description 'Exit with success status if the specified group already exists'
+complete -c groupadd -s g --description 'The numerical value of the group\'s ID'
+complete -c groupadd -s h -l help --description 'Display help message and exit'
+complete -c groupadd -s K --description 'Overrides default key/value pairs from /etc/login'
+complete -c groupadd -s o --description 'This option permits to add group with non-unique GID'
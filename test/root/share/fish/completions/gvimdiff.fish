@@ -0,0 +1 @@
+complete -c gvimdiff -w vim
@@ -0,0 +1,3 @@
+complete -c hash -s h -l help --description 'Display help and exit'
+complete -c hash -s r -l reset --description 'Forget all remembered command locations'
+complete -c hash --description "Command to look up" -xa "(__fish_complete_command)"
@@ -0,0 +1,2 @@
+complete -x -c ifdown -a "(__fish_print_interfaces)" --description "Network interface"
+complete -c ifdown -l force --description "force"
@@ -0,0 +1,2 @@
+complete -x -c ifup -a "(__fish_print_interfaces)" --description "Network interface"
+complete -c ifup -l force  --description "force"
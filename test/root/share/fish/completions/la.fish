@@ -0,0 +1 @@
+complete -c la -w ls
@@ -0,0 +1,2 @@
+__fish_complete_lpr lpmove
+
@@ -0,0 +1,3 @@
+
+__fish_complete_lpr lpq
+complete -c lpq -s l -d 'Requests a more verbose (long) reporting format'
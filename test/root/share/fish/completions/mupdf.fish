@@ -0,0 +1,2 @@
+complete -c mupdf -x -a "(__fish_complete_suffix .pdf)"
+
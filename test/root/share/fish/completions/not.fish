@@ -0,0 +1,4 @@
+
+complete -c not -s h -l help --description 'Display help and exit'
+complete -c not -xa '__fish_complete_subcommand'
+
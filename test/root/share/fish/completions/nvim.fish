@@ -0,0 +1 @@
+complete -c nvim -w vim
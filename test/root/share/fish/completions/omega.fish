@@ -0,0 +1,2 @@
+complete -c tex -w omega
+
@@ -0,0 +1 @@
+complete -c pacman-color -w pacman
@@ -0,0 +1,10 @@
+
+complete -c pbget -l abs --description 'Use the ABS tree'
+complete -c pbget -l arch --description 'Set the desired package architecture'
+complete -c pbget -l aur --description 'Search the AUR'
+complete -c pbget -l aur-only --description 'Only search the AUR'
+complete -c pbget -l dir --description 'Set the output directory'
+complete -c pbget -l help --description 'Display this message'
+complete -c pbget -l upgradable --description 'Search for upgradable packages'
+complete -c pbget -l testing --description 'Search the ABS testing branches'
+
@@ -0,0 +1,3 @@
+complete -c tex -w pdfelatex
+
+
@@ -0,0 +1 @@
+__fish_complete_ftp pftp
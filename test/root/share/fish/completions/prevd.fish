@@ -0,0 +1 @@
+complete -c prevd -s l --description "Also print directory history"
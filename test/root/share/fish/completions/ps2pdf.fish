@@ -0,0 +1,3 @@
+complete -c ps2pdf -x -a "(
+           __fish_complete_suffix .ps
+   )"
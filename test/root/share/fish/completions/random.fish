@@ -0,0 +1,2 @@
+
+complete -c random -s h -l help --description "Display help and exit"
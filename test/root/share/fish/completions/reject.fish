@@ -0,0 +1,3 @@
+__fish_complete_lpr reject
+complete -c reject -s r -d 'Reject reason' -x
+
@@ -0,0 +1,5 @@
+#completion for rejmerge
+
+complete -f -c rejmerge -o r -l root -d 'Alternative root'
+complete -f -c rejmerge -o v -l version -d 'Print version'
+complete -f -c rejmerge -o h -l help -d 'Print help'
@@ -0,0 +1,4 @@
+
+complete -c return -s h -l help --description "Display help and exit"
+complete -c return -x -a 0 -d "Return from function with normal exit status"
+complete -c return -x -a 1 -d "Return from function with abnormal exit status"
@@ -0,0 +1,12 @@
+
+complete -c scrot -s h -l help --description 'Display help and exit'
+complete -c scrot -s v -l version --description 'Display version information and exit'
+complete -c scrot -s b -l border --description 'When selecting a window, grab wm border too'
+complete -c scrot -s c -l count --description 'Display a countdown when used with delay'
+complete -c scrot -s d -l delay --description 'Wait NUMBER of seconds before taking a shot'
+complete -c scrot -s e -l exec --description 'Execute APPLICATION on the saved image'
+complete -c scrot -s q -l quality --description 'Image quality [1-100]'
+complete -c scrot -s m -l multidisp --description 'Grab shot from multiple heads'
+complete -c scrot -s s -l select --description 'Select a window or rectangle with the mouse'
+complete -c scrot -s t -l thumb --description 'Generate thumbnail PERCENT of original'
+
@@ -0,0 +1 @@
+complete -c sha512sum -w md5sum
@@ -0,0 +1,3 @@
+complete -c vared -x -a "(set|sed -e 's/ /'\t'Variable: /')"
+complete -c vared -s h -l help --description "Display help and exit"
+
@@ -0,0 +1 @@
+complete -c vimdiff -w vim
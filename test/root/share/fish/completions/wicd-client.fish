@@ -0,0 +1,6 @@
+complete -c wicd-client -s t -l tray	   -d 'Run the wicd tray icon only.'
+complete -c wicd-client -s n -l no-tray	   -d 'Run wicd without the tray icon.'
+complete -c wicd-client -s h -l help       -d 'Print this help information.'
+complete -c wicd-client -s a -l no-animate -d 'Run the tray without network traffic tray animations.'
+complete -c wicd-client -s o -l only-notifications -d 'Don\'t display anything except notifications.'
+
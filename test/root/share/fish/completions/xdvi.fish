@@ -0,0 +1 @@
+complete -c xdvi -x -a "(__fish_complete_suffix .dvi)"
@@ -0,0 +1,13 @@
+#
+# Alias for gettext or a fallback if gettext isn't installed.
+#
+if command -s gettext >/dev/null
+    function _ --description "Alias for the gettext command"
+        command gettext fish $argv
+    end
+else
+    function _ --description "Fallback alias for the gettext command"
+        echo -n $argv
+    end
+end
+
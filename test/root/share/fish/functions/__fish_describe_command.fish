@@ -0,0 +1,16 @@
+#
+# This function is used internally by the fish command completion code
+#
+
+function __fish_describe_command -d "Command used to find descriptions for commands"
+	apropos $argv ^/dev/null | awk -v FS=" +- +" '{
+		split($1, names, ", ");
+		for (name in names)
+			if (names[name] ~ /^'"$argv"'.* *\([18]\)/ ) {
+				sub( "( |\t)*\\\([18]\\\)", "", names[name] );
+				sub( " \\\[.*\\\]", "", names[name] );
+				print names[name] "\t" $2;
+			}
+	}'
+end
+
@@ -0,0 +1,3 @@
+function __fish_print_cmd_args_without_options
+    __fish_print_cmd_args | grep '^[^-]'
+end
@@ -0,0 +1,7 @@
+#
+# These are very common and useful
+#
+function la --description "List contents of directory, including hidden files in directory using long format"
+	ls -lah $argv
+end
+